@@ -8,6 +8,7 @@
 #include <array>
 #include <algorithm>
 #include "shared_types.h"
+#include "BMSPackTopology.h"
 
 using volt = float;
 using celsius = float;
@@ -103,10 +104,10 @@ namespace ACUInterfaces {
 
 namespace ACUConstants
 {  
-    constexpr size_t NUM_CELLS = 126;
-    constexpr size_t NUM_CHIPS = 12;
-    constexpr size_t NUM_CELL_TEMPS = 48;
-    constexpr size_t NUM_CHIP_SELECTS = 2;
+    constexpr size_t NUM_CELLS = ACUPackTopology::num_cells;
+    constexpr size_t NUM_CHIPS = bms_pack_layout::NUM_CHIPS;
+    constexpr size_t NUM_CELL_TEMPS = ACUPackTopology::num_cell_temps;
+    constexpr size_t NUM_CHIP_SELECTS = bms_pack_layout::NUM_CHIP_SELECTS;
 
     const float VALID_SHDN_OUT_MIN_VOLTAGE_THRESHOLD = 12.0F;
     const uint32_t MIN_ALLOWED_INVALID_SHDN_OUT_MS = 10;  // 10 ms -- requies 100 Hz samp freq.
@@ -116,13 +117,41 @@ namespace ACUConstants
     constexpr std::array<int, NUM_CHIPS> CS_PER_CHIP = {36, 36, 36, 36, 36, 36, 38, 38, 38, 38, 38, 38};
     constexpr std::array<int, NUM_CHIPS> ADDR = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}; // only for addressable bms chips
 
+    // Read BMS groups without blocking: wakeup pulses and SPI1 DMA frames are stepped by service_bms_read,
+    // the read is started in one SAMPLE_BMS tick and decoded in the next
+    constexpr bool USE_ASYNC_BMS_READ = false;
+    // Reads all six register groups per sample_bms_data call instead of one, every frame comes from the same conversions
+    constexpr bool USE_BURST_BMS_ACQUISITION = false;
+    // Lower a chip select's isoSPI clock while its PEC failure rate is high, and raise it back once quiet
+    constexpr bool USE_ADAPTIVE_BMS_SPI_CLOCK = false;
+    // Read the LTC6811 OV / UV comparator flags (RDSTATB) after every BMS read, so a cell past its limit starts the
+    // voltage fault timer before the round robin gets back to the group holding it
+    constexpr bool USE_BMS_OV_UV_FAST_PATH = false;
+    // Measure the pack with an LTC6811 sum of cells conversion (ADSTAT) at init and ahead of a BMS read every
+    // SUM_OF_CELLS_PERIOD_US. One coherent pack voltage for SoC init, the pack UV check and the ACU data, instead of
+    // the cell total that takes a whole group cycle to refresh
+    constexpr bool USE_BMS_SUM_OF_CELLS = false;
+    // Pick the BMS sampling rate and ADC mode from the ACU state (BMSSamplingPolicy): slow + filtered in STARTUP / FAULTED,
+    // fast in ACTIVE and while charging close to OV. SAMPLE_BMS runs at the fast period and skips the ticks it doesn't need
+    constexpr bool USE_ADAPTIVE_BMS_SAMPLING = false;
+    // Read the register groups holding the min / max cell and the hottest thermistor more often than the rest
+    // (AcquisitionMode_e::WEIGHTED), every group is still read within MAX_GROUP_STALENESS_READS. Ignored with burst acquisition
+    constexpr bool USE_WEIGHTED_BMS_SCHEDULING = false;
+    // Run the LTC6811 self tests (open wire, mux, cell / sum of cells cross check) in turn after the BMS read, within
+    // the driver's diagnostics_budget_us_per_s and the rest of the SAMPLE_BMS tick. Synchronous reads only: with async reads the next group read follows
+    // the previous one without a gap to put them in
+    constexpr bool USE_BMS_DIAGNOSTICS = false;
+
     /* Task Times */
     constexpr uint32_t TICK_SM_PERIOD_US = 1000UL; // 1 000 us = 1000 Hz
     constexpr uint32_t TICK_SM_PRIORITY = 9;
     constexpr uint32_t KICK_WATCHDOG_PERIOD_US = 5000UL; // 5000 us = 200 Hz
     constexpr uint32_t WATCHDOG_PRIORITY = 1;
-    constexpr uint32_t SAMPLE_BMS_PERIOD_US = 100000UL; // 10 000 us = 100 Hz (since we are reading by group)
+    constexpr uint32_t SAMPLE_BMS_PERIOD_US = USE_ADAPTIVE_BMS_SAMPLING ? 10000UL : 100000UL; // 100 000 us = 10 Hz (since we are reading by group), 10 000 us = 100 Hz when adaptive
     constexpr uint32_t SAMPLE_BMS_PRIORITY = 2;
+    constexpr uint32_t SUM_OF_CELLS_PERIOD_US = 100000UL; // 100 000 us = 10 Hz, sample_bms_data runs the blocking ADSTAT at most this often (only with USE_BMS_SUM_OF_CELLS)
+    constexpr uint32_t SERVICE_BMS_READ_PERIOD_US = 50UL; // 50 us = 20 kHz, steps the async BMS read protocol (only scheduled with USE_ASYNC_BMS_READ)
+    constexpr uint32_t SERVICE_BMS_READ_PRIORITY = 2;
     constexpr uint32_t EVAL_ACC_PERIOD_US = 20000UL; // 20 000 us = 50 Hz
     constexpr uint32_t EVAL_ACC_PRIORITY = 10;
     constexpr uint32_t WRITE_CELL_BALANCE_PERIOD_US = 100000UL; // 100 000 us = 10 Hz
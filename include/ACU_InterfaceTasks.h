@@ -8,6 +8,8 @@
 /* Interface Library Includes */
 #include "BMSDriverGroup.h"
 #include "BMSFaultDataManager.h"
+#include "BMSSPIClockController.h"
+#include "BMSSamplingPolicy.h"
 #include "WatchdogInterface.h"
 #include "WatchdogMetrics.h"
 #include "ACUEthernetInterface.h"
@@ -24,7 +26,8 @@
 
 using chip_type = LTC6811_Type_e;
 using BMSDriverInstance_t = BMSDriverInstance<ACUConstants::NUM_CHIPS, ACUConstants::NUM_CHIP_SELECTS, chip_type::LTC6811_1>;
-using BMSFaultDataManagerInstance_t = BMSFaultDataManagerInstance<ACUConstants::NUM_CHIPS>;
+using BMSFaultDataManagerInstance_t = BMSFaultDataManagerInstance<ACUConstants::NUM_CHIPS, ACUConstants::NUM_CHIP_SELECTS>;
+using BMSSPIClockControllerInstance_t = BMSSPIClockControllerInstance<ACUConstants::NUM_CHIP_SELECTS>;
 // using MAX1148ADCInstance_t = MAX114XInterfaceInstance<ACUConstants::NUM_MAX1148_CHANNELS, ACUInterfaces::MAX114X_VERSION>;
 /**
  * Init Functions - to be called in setup@
@@ -38,6 +41,11 @@ void initialize_all_interfaces();
 
 ::HT_TASK::TaskResponse sample_bms_data(const unsigned long& sysMicros, const HT_TASK::TaskInfo& taskInfo);
 
+/**
+ * Advances the wakeup pulses / frames of an async BMS read without blocking, in place of delayMicroseconds()
+ */
+::HT_TASK::TaskResponse service_bms_read(const unsigned long& sysMicros, const HT_TASK::TaskInfo& taskInfo);
+
 ::HT_TASK::TaskResponse write_cell_balancing_config(const unsigned long& sysMicros, const HT_TASK::TaskInfo& taskInfo);
 
 ::HT_TASK::TaskResponse handle_send_ACU_core_ethernet_data(const unsigned long &sysMicros, const HT_TASK::TaskInfo &taskInfo);
@@ -66,6 +74,6 @@ void initialize_all_interfaces();
 
 
 template <typename bms_data>
-void print_bms_data(bms_data data);
+void print_bms_data(const bms_data &data);
 
 #endif 
\ No newline at end of file
@@ -20,7 +20,7 @@
 
 using chip_type = LTC6811_Type_e;
 using BMSDriverInstance_t = BMSDriverInstance<ACUConstants::NUM_CHIPS, ACUConstants::NUM_CHIP_SELECTS, chip_type::LTC6811_1>;
-using BMSFaultDataManagerInstance_t = BMSFaultDataManagerInstance<ACUConstants::NUM_CHIPS>;
+using BMSFaultDataManagerInstance_t = BMSFaultDataManagerInstance<ACUConstants::NUM_CHIPS, ACUConstants::NUM_CHIP_SELECTS>;
 bool initialize_all_systems();
 
 /* Delegate Functions */
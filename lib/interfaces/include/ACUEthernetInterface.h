@@ -9,6 +9,7 @@
 
 #include "SharedFirmwareTypes.h"
 #include "shared_types.h"
+#include "BMSPackTopology.h"
 
 #include "device_fw_version.h"
 
@@ -17,11 +18,14 @@
 using namespace qindesign::network;
 
 namespace acu_ethernet_params {
-  constexpr const uint8_t NUM_CELLS = 126;
-  constexpr const uint8_t NUM_CELLTEMPS = 48;
-  constexpr const uint8_t NUM_CHIPS = 12;
+  constexpr const uint8_t NUM_CELLS = ACUPackTopology::num_cells;
+  constexpr const uint8_t NUM_CELLTEMPS = ACUPackTopology::num_cell_temps;
+  constexpr const uint8_t NUM_CHIPS = bms_pack_layout::NUM_CHIPS;
+  constexpr const uint16_t BMS_ACQUISITION_DATA_PORT = 7781; // not part of EthernetIPDefs, the datagram is owned by this repo
 };
 
+using ACUBMSAcquisitionTelemetry_s = BMSAcquisitionTelemetry_s<ACUPackTopology::num_cells, ACUPackTopology::num_cell_temps, bms_pack_layout::NUM_CHIP_SELECTS>;
+
 struct ACUParams_s {
   uint8_t num_cells;
   uint8_t num_celltemps;
@@ -44,6 +48,11 @@ public:
 
   void handle_send_ethernet_acu_core_data(const hytech_msgs_ACUCoreData &data);
 
+  /**
+   * Sends the BMS acquisition health datagram to the drivebrain, raw bytes of ACUBMSAcquisitionTelemetry_s
+   */
+  void handle_send_ethernet_bms_acquisition_data(const ACUBMSAcquisitionTelemetry_s &data);
+
   /**
    * Function to transform our struct from shared_data_types into the protoc struct hytech_msgs_ACUCoreData_s.
    *
@@ -64,6 +73,7 @@ private:
   /* Ethernet Sockets */
   EthernetUDP _acu_core_data_send_socket;
   EthernetUDP _acu_all_data_send_socket;
+  EthernetUDP _bms_acquisition_data_send_socket;
   EthernetUDP _vcr_data_recv_socket;
   EthernetUDP _db_data_recv_socket;
 
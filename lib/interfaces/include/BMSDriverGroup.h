@@ -2,6 +2,12 @@
 #define BMSDriverGroup_H
 
 #include "LTCSPIInterface.h"
+#include "LTCCommandFrames.h"
+#include "BMSPackTopology.h"
+#include "GPIOTemperatureLUT.h"
+#include "MinMaxTree.h"
+#include "GroupReadScheduler.h"
+#include "DiagnosticsSlotScheduler.h"
 
 #include <Arduino.h>
 #include <SPI.h>
@@ -9,6 +15,8 @@
 #include <cstdint>
 #include "etl/optional.h"
 #include <numeric>
+#include <cmath>
+#include <algorithm>
 
 #include "etl/singleton.h"
 
@@ -21,51 +29,6 @@ enum class LTC6811_Type_e
     LTC6811_2       ///< Address mode (reference only)
 };
 
-// Command Codes
-enum class CMD_CODES_e
-{
-    // WRITES
-    WRITE_CONFIG = 0x1,
-    WRITE_S_CONTROL = 0x14,
-    WRITE_PWM = 0x20,
-    WRITE_COMM = 0x721,
-    // READS
-    READ_CONFIG = 0x2,
-    READ_CELL_VOLTAGE_GROUP_A = 0x4,
-    READ_CELL_VOLTAGE_GROUP_B = 0x6,
-    READ_CELL_VOLTAGE_GROUP_C = 0x8,
-    READ_CELL_VOLTAGE_GROUP_D = 0xA,
-    READ_GPIO_VOLTAGE_GROUP_A = 0xC,
-    READ_GPIO_VOLTAGE_GROUP_B = 0xE,
-    READ_STATUS_GROUP_A = 0x10,
-    READ_STATUS_GROUP_B = 0x12,
-    READ_S_CONTROL = 0x16,
-    READ_PWM = 0x22,
-    READ_COMM = 0x722,
-    // STARTS
-    START_S_CONTROL = 0x19,
-    START_CV_ADC_CONVERSION = 0x260,
-    START_GPIO_ADC_CONVERSION = 0x460,
-    START_CV_GPIO_ADC_CONVERSION = 0x46F,
-    START_CV_SC_CONVERSION = 0x467,
-    START_COMM = 0x723,
-    // CLEARS
-    CLEAR_S_CONTROL = 0x18,
-    CLEAR_GPIOS = 0x712,
-    CLEAR_STATUS = 0x713,
-    // POLL ADC STATUS, DIAGNOSE MUX
-    POLL_ADC_STATUS = 0x714,
-    DIAGNOSE_MUX_POLL_STATUS = 0x715
-};
-
-enum class ADC_MODE_e : uint8_t
-{
-    MODE_ZERO = 0x0,
-    FAST = 0x1,
-    NORMAL = 0x2,
-    FILTERED = 0x3
-};
-
 namespace bms_driver_defaults
 {
     constexpr const bool DEVICE_REFUP_MODE = true;
@@ -84,17 +47,41 @@ namespace bms_driver_defaults
     constexpr const uint16_t CRC15_POLY = 0x4599; // Used for calculating the PEC table for LTC6811
     constexpr const float CV_ADC_CONVERSION_TIME_MS = 1.2f;
     constexpr const float GPIO_ADC_CONVERSION_TIME_MS = 1.2f;
+    constexpr const std::array<float, 4> ADC_CONVERSION_TIME_MS_BY_MODE = {12.9f, 1.2f, 2.4f, 202.0f}; // ADCV / ADAX per ADC_MODE_e, for modes other than the configured ones
+    constexpr const float STATUS_ADC_CONVERSION_TIME_MS = 1.6f; // ADSTAT, upper bound for every channel at 7 kHz, SC alone is shorter
+    constexpr const std::array<float, 4> STATUS_ADC_CONVERSION_TIME_MS_BY_MODE = {2.2f, 0.3f, 0.5f, 34.0f}; // ADSTAT SC only per ADC_MODE_e, for modes other than the configured one
     constexpr const float CV_ADC_LSB_VOLTAGE = 0.0001f; // Cell voltage ADC resolution: 100μV per LSB (1/10000 V)
+    constexpr const float SC_ADC_LSB_VOLTAGE = 0.002f;  // Sum of cells resolution: 20 cell LSBs, 2mV per LSB
+    constexpr const uint32_t ISOSPI_IDLE_TIMEOUT_US = 4000;   // t_IDLE is 4.3ms min, after that the isoSPI ports go back to IDLE
+    constexpr const uint32_t CORE_SLEEP_TIMEOUT_US = 1500000; // t_SLEEP is 1.8s min, after that the core goes back to SLEEP
+    constexpr const uint32_t CONFIG_REFRESH_PERIOD_US = 1000000; // Rewrite an unchanged CFGR this often anyway, recovers chips that reset. 0 = never
+    constexpr const uint8_t CONFIG_VERIFY_INTERVAL_WRITES = 1;   // Read CFGR back after every Nth write on a chip select, rewrite it on a mismatch. 0 = never
+    constexpr const bool VERIFY_CONFIG_BEFORE_REFRESH = true;    // A due refresh reads CFGR back first and only rewrites if the chips lost it
+    constexpr const bool COMBINED_CV_GPIO_CONVERSION = false;    // ADCVAX once per cycle instead of separate ADCV + ADAX
+    constexpr const uint8_t COMBINED_MODE_FULL_GPIO_INTERVAL = 2; // In combined mode, cycles between ADAX conversions of GPIO3-5
+    constexpr const uint8_t CV_SWEEPS_PER_AUX_SWEEP = 1; // Round robin: CV A-D sweeps, each with its own ADCV, per AUX A-B sweep. 1 = the plain six group cycle
+    constexpr const bool POLL_ADC_STATUS = false; // PLADC before reading a group that depends on a conversion still in flight
+    constexpr const float POLL_TIMEOUT_MARGIN_MS = 2.0f; // A blocking PLADC wait gives up this long past the nominal conversion time
+    constexpr const uint8_t PEC_RETRY_BUDGET_PER_READ = 2; // Re-reads of PEC-failed groups allowed per read_data() call, or per async group read. 0 = never retry
+    constexpr const uint16_t ACQUISITION_LATENCY_WINDOW = 64; // Group reads per acquisition latency statistics window
+    constexpr const uint8_t HOT_GROUP_WEIGHT = 4;            // Weighted mode: groups holding the min / max cell or hottest thermistor are read this much more often
+    constexpr const uint16_t MAX_GROUP_STALENESS_READS = 12; // Weighted mode: most reads of other groups before a group is read again, at least 5
+    constexpr const uint32_t DIAGNOSTICS_BUDGET_US_PER_S = 20000; // Bus / conversion time run_diagnostics_slot() may spend per second, 2%. 0 = never
+    constexpr const uint8_t DIAGNOSTIC_ADC_MODE = 0x1;            // FAST: diagnostics cost the same whatever mode the measurements run in
+    constexpr const uint8_t OPEN_WIRE_CONVERSIONS_PER_DIRECTION = 2; // ADOW repeats per pull direction, the datasheet asks for at least 2
+    constexpr const float MUX_DIAGNOSTIC_TIME_MS = 1.0f;          // DIAGN, upper bound on the multiplexer self test
+    constexpr const float SC_CROSS_CHECK_TOLERANCE_V = 0.15f;     // Most a chip's SC may differ from its summed cells, ~0.3% of a 12 cell stack
+}
+
+namespace ltc_wakeup_timing
+{
+    constexpr const int T_WAKE_US = 400; // SLEEP -> STANDBY, used when the core may be asleep
+    constexpr const int T_READY_US = 10; // isoSPI IDLE -> READY, used when only the ports have timed out
 }
 
 namespace ref_max_min_defaults
 {
-    constexpr const volt TOTAL_VOLTAGE = 0;
-    constexpr const volt MAX_CELL_VOLTAGE = 0;
-    constexpr const volt MIN_CELL_VOLTAGE = 10;
-    constexpr const celsius MIN_CELL_TEMP = 80;
-    constexpr const celsius MAX_CELL_TEMP = 0;
-    constexpr const celsius MAX_BOARD_TEMP = 0;
+    constexpr const uint32_t TOTAL_VOLTAGE_CODE = 0;
 };
 
 struct ValidPacketData_s
@@ -107,13 +94,22 @@ struct ValidPacketData_s
     bool valid_read_gpios_4_to_6 = true;
 };
 
-template <size_t num_chips, size_t num_cells, size_t num_board_thermistors>
+/**
+ * When the data of one register group on one chip select was captured
+ */
+struct GroupCaptureTime_s
+{
+    uint32_t conversion_start_us = 0; // micros() when the oldest ADC conversion behind the group's data was started
+    uint32_t read_us = 0;             // micros() when the group's registers were read back with at least one valid PEC
+};
+
+template <size_t num_chips, size_t num_cells, size_t num_board_thermistors, size_t num_chip_selects = 1>
 struct BMSData_s
 {
     std::array<ValidPacketData_s, num_chips> valid_read_packets;
-    std::array<volt, num_cells> voltages;
-    std::array<celsius, 4 * num_chips> cell_temperatures;
-    std::array<celsius, num_board_thermistors> board_temperatures;
+    std::array<uint16_t, num_cells> voltage_codes;                        // Raw cell voltage codes, CV_ADC_LSB_VOLTAGE per LSB
+    std::array<uint16_t, 4 * num_chips> cell_temperature_codes;           // Raw GPIO1-4 (thermistor) codes, 100 uV per LSB
+    std::array<uint16_t, num_board_thermistors> board_temperature_codes; // Raw GPIO5 (MCP9701) codes, 100 uV per LSB
     volt min_cell_voltage;
     volt max_cell_voltage;
     celsius max_cell_temp;
@@ -127,17 +123,163 @@ struct BMSData_s
     volt total_voltage;
     volt avg_cell_voltage;
     celsius average_cell_temperature;
+    uint32_t frame_timestamp_us; // micros() when the cell conversion behind the latest complete set of voltages was started
+    // Per read group and chip select. Chips that failed PEC on that read keep older data, see valid_read_packets
+    std::array<std::array<GroupCaptureTime_s, num_chip_selects>, ReadGroup_e::NUM_GROUPS> group_capture_times;
+
+    /**
+     * Per-element conversions of the raw codes, done on every call. Prefer these for the few values a consumer needs
+     */
+    volt voltage(size_t cell) const
+    {
+        return voltage_codes[cell] * bms_driver_defaults::CV_ADC_LSB_VOLTAGE;
+    }
+
+    celsius cell_temperature(size_t thermistor) const
+    {
+        return gpio_temperature_lut::thermistor_code_to_celsius(cell_temperature_codes[thermistor]);
+    }
+
+    celsius board_temperature(size_t chip) const
+    {
+        return gpio_temperature_lut::mcp9701_code_to_celsius(board_temperature_codes[chip]);
+    }
+
+    /**
+     * Batched conversions for consumers that need a whole array as floats
+     * @pre out has room for the whole array
+     */
+    void convert_voltages(volt *out) const
+    {
+        for (size_t cell = 0; cell < num_cells; cell++)
+        {
+            out[cell] = voltage(cell);
+        }
+    }
+
+    void convert_cell_temperatures(celsius *out) const
+    {
+        for (size_t thermistor = 0; thermistor < cell_temperature_codes.size(); thermistor++)
+        {
+            out[thermistor] = cell_temperature(thermistor);
+        }
+    }
+
+    void convert_board_temperatures(celsius *out) const
+    {
+        for (size_t chip = 0; chip < num_board_thermistors; chip++)
+        {
+            out[chip] = board_temperature(chip);
+        }
+    }
+};
+
+/**
+ * A read published by the driver. sequence counts publishes (0 = nothing published yet), so a reader that keeps
+ * the last sequence it saw can tell whether the data is new since its last look
+ */
+template <typename bms_data_t>
+struct BMSDataSnapshot_s
+{
+    bms_data_t data;
+    uint32_t sequence;
+    uint32_t published_us; // micros() when the read was published
+    uint8_t read_groups;   // bit per ReadGroup_e read (or skipped) since the previous publish
+};
+
+/**
+ * The LTC6811 OV / UV comparator flags (Status Register Group B) of every chip. The chips compare every cell against
+ * the CFGR VOV / VUV thresholds at the end of each cell conversion, so these cover the whole stack in one short read
+ * instead of waiting for the round robin to reach the group holding the cell. Bit n = cell n + 1 of the chip, cells a
+ * chip doesn't have are masked off. Chips that failed PEC keep the flags of their last good read
+ */
+template <size_t num_chips>
+struct CellVoltageFlags_s
+{
+    std::array<uint16_t, num_chips> over_voltage = {};
+    std::array<uint16_t, num_chips> under_voltage = {};
+    std::array<bool, num_chips> valid = {}; // PEC of the last read
+    uint32_t read_us = 0;                   // micros() when the flags were last read
+
+    bool any_over_voltage() const
+    {
+        return std::any_of(over_voltage.begin(), over_voltage.end(), [](uint16_t flags) { return flags != 0; });
+    }
+
+    bool any_under_voltage() const
+    {
+        return std::any_of(under_voltage.begin(), under_voltage.end(), [](uint16_t flags) { return flags != 0; });
+    }
 };
 
+/**
+ * Sum of cells of every chip (ADSTAT + Status Register Group A). Each chip measures its whole stack in one conversion,
+ * so the total is coherent, unlike total_voltage which is built from six group reads that land at different times.
+ * Chips that failed PEC keep the code of their last good read
+ */
+template <size_t num_chips>
+struct SumOfCellsData_s
+{
+    std::array<uint16_t, num_chips> sum_of_cells_codes = {}; // SC_ADC_LSB_VOLTAGE per LSB
+    std::array<bool, num_chips> valid = {};                  // PEC of the last read
+    uint32_t conversion_start_us = 0;                        // micros() when the last ADSTAT went out, 0 = never read
+
+    bool all_valid() const
+    {
+        return std::all_of(valid.begin(), valid.end(), [](bool chip_valid) { return chip_valid; });
+    }
+
+    volt chip_voltage(size_t chip) const
+    {
+        return sum_of_cells_codes[chip] * bms_driver_defaults::SC_ADC_LSB_VOLTAGE;
+    }
+
+    volt pack_voltage() const
+    {
+        return std::accumulate(sum_of_cells_codes.begin(), sum_of_cells_codes.end(), 0UL) * bms_driver_defaults::SC_ADC_LSB_VOLTAGE;
+    }
+};
+
+/**
+ * Results of the background diagnostics (run_diagnostics_slot()), per chip. Chips that failed PEC on a diagnostic's
+ * read back keep that diagnostic's previous result, and are marked invalid for it
+ */
+template <size_t num_chips>
+struct BMSDiagnosticsData_s
+{
+    std::array<uint16_t, num_chips> open_wires = {};     // bit n set: wire Cn (0 = C0, the chip's bottom) is open
+    std::array<bool, num_chips> mux_fail = {};           // MUXFAIL after DIAGN
+    std::array<bool, num_chips> thermal_shutdown = {};   // THSD, latched by the chip
+    std::array<float, num_chips> sc_minus_cells_v = {};  // ADCVSC sum of cells minus the summed cells of the same conversion
+    std::array<bool, num_chips> sc_mismatch = {};        // |sc_minus_cells_v| over sc_cross_check_tolerance_v
+    std::array<std::array<bool, num_chips>, NUM_BMS_DIAGNOSTICS> valid = {}; // indexed by BMSDiagnostic_e
+    std::array<uint32_t, NUM_BMS_DIAGNOSTICS> last_run_us = {};              // micros() when each diagnostic last ran, 0 = never
+
+    bool any_fault() const
+    {
+        return std::any_of(open_wires.begin(), open_wires.end(), [](uint16_t wires) { return wires != 0; }) ||
+               std::any_of(mux_fail.begin(), mux_fail.end(), [](bool fail) { return fail; }) ||
+               std::any_of(thermal_shutdown.begin(), thermal_shutdown.end(), [](bool shutdown) { return shutdown; }) ||
+               std::any_of(sc_mismatch.begin(), sc_mismatch.end(), [](bool mismatch) { return mismatch; });
+    }
+};
+
+/**
+ * Running aggregates over the raw codes. The extremes live in the driver's MinMaxTrees
+ */
 struct ReferenceMaxMin_s
 {
-    volt total_voltage;
-    volt max_cell_voltage;
-    volt min_cell_voltage;
-    celsius min_cell_temp;
-    celsius max_cell_temp;
-    celsius max_board_temp;
-    celsius total_thermistor_temps;
+    uint32_t total_voltage_code;
+};
+
+/**
+ * How read_data() walks the register groups
+ */
+enum class AcquisitionMode_e
+{
+    ROUND_ROBIN = 0, // One register group per call, a full frame takes six calls. Lowest CPU / bus time per call
+    BURST,           // Converts and reads all six groups in one call, every group comes from the same conversions
+    WEIGHTED         // One register group per call, groups holding the extreme cells / hottest thermistor are read more often
 };
 
 struct BMSDriverGroupConfig_s
@@ -158,7 +300,90 @@ struct BMSDriverGroupConfig_s
     uint16_t CRC15_POLY;
     float cv_adc_conversion_time_ms;
     float gpio_adc_conversion_time_ms;
-    float cv_adc_lsb_voltage;
+    float status_adc_conversion_time_ms;
+    uint32_t isospi_idle_timeout_us;
+    uint32_t core_sleep_timeout_us;
+    uint32_t config_refresh_period_us;
+    uint8_t config_verify_interval_writes;
+    bool verify_config_before_refresh;
+    bool combined_cv_gpio_conversion;
+    uint8_t combined_mode_full_gpio_interval;
+    uint8_t cv_sweeps_per_aux_sweep;
+    bool poll_adc_status;
+    float poll_timeout_margin_ms;
+    uint8_t pec_retry_budget_per_read;
+    uint16_t acquisition_latency_window;
+    uint8_t hot_group_weight;
+    uint16_t max_group_staleness_reads;
+    uint32_t diagnostics_budget_us_per_s;
+    uint8_t diagnostic_adc_mode;
+    uint8_t open_wire_conversions_per_direction;
+    float mux_diagnostic_time_ms;
+    float sc_cross_check_tolerance_v;
+};
+
+/**
+ * Counts how each wakeup request was handled, per call to _start_wakeup_protocol(cs)
+ */
+struct WakeupStats_s
+{
+    uint32_t full_wakeups_sent = 0;   // t_WAKE pulses, core could have been asleep
+    uint32_t isospi_wakeups_sent = 0; // t_READY pulses, core awake but isoSPI ports idle
+    uint32_t wakeups_skipped = 0;     // bus was active within t_IDLE, nothing sent
+};
+
+/**
+ * Conversion latency as seen by PLADC polling: from the ADC start command to the first poll that reported done.
+ * Resolution is the polling cadence (one poll per read_data() call), so these are upper bounds.
+ */
+struct ConversionLatencyStats_s
+{
+    uint32_t last_latency_us = 0;
+    uint32_t min_latency_us = UINT32_MAX;
+    uint32_t max_latency_us = 0;
+    uint32_t conversions_completed = 0;
+    uint32_t polls_not_ready = 0; // reads held back because the stack was still converting
+    uint32_t conversion_timeouts = 0; // blocking waits that gave up, the reads depending on them were marked invalid
+};
+
+/**
+ * Counts CFGR writes per chip select: sent because something changed / was due a refresh, or skipped
+ * because the chips already hold the requested configuration. Read backs (RDCFG) are counted per chip select too,
+ * a failed one (mismatch or PEC error on any chip) rewrites that chip select
+ */
+struct ConfigWriteStats_s
+{
+    uint32_t config_writes_sent = 0;
+    uint32_t config_writes_skipped = 0;
+    uint32_t config_verifications = 0;
+    uint32_t config_verification_failures = 0;
+    uint32_t refresh_writes_avoided = 0; // due refreshes a matching read back made unnecessary
+};
+
+/**
+ * Acquisition latency: from the start of the conversion behind a register group to its read landing in the data,
+ * one sample per chip select per group read. min / avg / max cover the last complete window of
+ * acquisition_latency_window samples, so they track the current schedule instead of all history
+ */
+struct AcquisitionLatencyStats_s
+{
+    uint32_t last_latency_us = 0;
+    uint32_t window_min_latency_us = 0;
+    uint32_t window_avg_latency_us = 0;
+    uint32_t window_max_latency_us = 0;
+    uint32_t windows_completed = 0;
+};
+
+/**
+ * Counts re-reads of register groups that failed PEC. Chips are counted individually: one re-read on a chip select
+ * can recover some chips and not others. Recovery rate = chips_recovered / (chips_recovered + chips_not_recovered)
+ */
+struct PECRetryStats_s
+{
+    uint32_t retries_sent = 0;          // re-read frames sent
+    uint32_t chips_recovered = 0;       // chips that failed PEC and read back valid on a retry
+    uint32_t chips_not_recovered = 0;   // chips still invalid once the retries for that group were done
+    uint32_t retries_out_of_budget = 0; // group reads left invalid because the read_data() call had no retries left
 };
 
 
@@ -178,12 +403,22 @@ template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
 class BMSDriverGroup
 {
 public:
-    constexpr static size_t num_cells = (num_chips / 2) * 21;
+    // Where every cell / thermistor lives, see bms_pack_layout to change the pack
+    using Topology = BMSPackTopology<num_chips, num_chip_selects>;
+
+    constexpr static size_t num_cells = Topology::num_cells;
+
+    constexpr static size_t num_cell_temps = Topology::num_cell_temps;
+    constexpr static size_t num_board_temps = Topology::num_board_temps;
 
-    constexpr static size_t num_cell_temps = (num_chips * 4);
-    constexpr static size_t num_board_temps = num_chips;
+    // Broadcast mode wakes every chip on a chip select with one pulse per chip, address mode needs one
+    constexpr static size_t num_wakeup_pulses = (chip_type == LTC6811_Type_e::LTC6811_1) ? ((num_chips + 1) / num_chip_selects) : 1;
 
-    using BMSDriverData = BMSData_s<num_chips, num_cells, num_chips>;
+    using BMSDriverData = BMSData_s<num_chips, num_cells, num_chips, num_chip_selects>;
+    using BMSDriverSnapshot = BMSDataSnapshot_s<BMSDriverData>;
+    using BMSCellVoltageFlags = CellVoltageFlags_s<num_chips>;
+    using BMSSumOfCellsData = SumOfCellsData_s<num_chips>;
+    using BMSDiagnosticsData = BMSDiagnosticsData_s<num_chips>;
 
     BMSDriverGroup(
         const std::array<int, num_chip_selects>& cs,
@@ -209,11 +444,42 @@ public:
      * For each BMS segment, there is 6 board thermistors and 2 humidity sensors.
      * NOTE: Conversions are different depending on which we are reading.
      * @pre in order to actually "read" anything, we need to call wakeup() and send data over SPI
-     * @post store all temperature data into the board_temperatures container
+     * @post store all raw temperature codes into the cell / board temperature code containers
      * AND record the maximum value and locations
      */
     // void read_thermistor_and_humidity();
-    BMSDriverData read_data();
+    const BMSDriverData &read_data();
+
+    /**
+     * Non-blocking variant of read_data() for LTC6811_1 (broadcast) chips.
+     * Writes the configuration, wakes the chip selects, then hands the register group read for every
+     * chip select to the DMA engine and returns. The data is decoded by finish_read_data_async() in a later tick.
+     * If that left chips with a failed PEC and the retry budget has room, this re-reads the same group on their
+     * chip selects instead of starting on the next one.
+     * @return false if a transfer is already in flight / not finished yet, or the DMA could not start
+     */
+    bool start_read_data_async();
+
+    /**
+     * @return true once the transfer started by start_read_data_async() is done and ready to decode
+     */
+    bool is_async_read_complete();
+
+    /**
+     * Runs every protocol step of the async read that is due (wakeup pulses, frames, chip select release).
+     * Never waits, so it is meant to be called far more often than the read itself, from its own scheduler task.
+     */
+    void service_async_read();
+
+    /**
+     * Decodes the register group read by start_read_data_async(), then advances the read group and starts
+     * ADC conversions exactly like read_data() does. Chips that failed PEC are held for a re-read by the next
+     * start_read_data_async() while the group's retry budget (pec_retry_budget_per_read) lasts, the group only
+     * advances and gets published once they read valid or the budget is spent.
+     * @pre is_async_read_complete()
+     * @return the updated BMS data, unchanged if there was nothing to decode or a retry is pending
+     */
+    const BMSDriverData &finish_read_data_async();
 
     /**
      * Getter function to retrieve the ACUData structure
@@ -221,16 +487,70 @@ public:
     BMSCoreData_s get_bms_core_data();
 
     /**
-     * Getter function to retrieve the BMSDriverData structure
+     * Getter function to retrieve the latest published BMSDriverData structure, no copy is made.
+     * The reference stays valid (and unchanged) through the next read, the one after reuses its buffer
+     */
+    const BMSDriverData &get_bms_data() const { return _snapshots[_front_snapshot].data; }
+
+    /**
+     * @return the latest published read with its sequence number and publish time
+     */
+    const BMSDriverSnapshot &get_bms_snapshot() const { return _snapshots[_front_snapshot]; }
+
+    /**
+     * Reads Status Register Group B on every chip select and decodes the OV / UV comparator flags of every chip.
+     * One 8 byte per chip read per chip select, no conversion is started: the flags are from the latest cell conversion
+     * @note compared against the CFGR thresholds (under_voltage_threshold / over_voltage_threshold), without any IR compensation
+     * @return the flags, also kept for get_cell_voltage_flags()
+     */
+    const BMSCellVoltageFlags &read_cell_voltage_flags();
+
+    /**
+     * @return the flags of the last read_cell_voltage_flags()
      */
-    BMSDriverData get_bms_data();
+    const BMSCellVoltageFlags &get_cell_voltage_flags() const { return _cell_voltage_flags; }
+
+    /**
+     * Runs a sum of cells conversion (ADSTAT, SC only) on every chip and reads it back from Status Register Group A.
+     * Blocking: waits out any conversion still in flight, then the ADSTAT itself, which runs in the active cell mode
+     * (status_adc_conversion_time_ms in the configured mode, STATUS_ADC_CONVERSION_TIME_MS_BY_MODE otherwise).
+     * The cell / GPIO registers are untouched, so it can go between any two read_data() calls
+     * @return the sums, also kept for get_sum_of_cells_data()
+     */
+    const BMSSumOfCellsData &read_sum_of_cells();
+
+    /**
+     * @return the sums of the last read_sum_of_cells()
+     */
+    const BMSSumOfCellsData &get_sum_of_cells_data() const { return _sum_of_cells; }
+
+    /**
+     * Runs the next background diagnostic (open wire, mux self test, cell / SC cross check, in turn) if the
+     * diagnostics budget has room for it and it fits in slot_us, otherwise nothing. Blocking, call right after a
+     * read_data() with the time left before the next read is due, so the time comes out of that gap and never
+     * pushes the next read back. Waits out any conversion in flight first (counted against slot_us), and
+     * diagnostics that overwrite the cell registers end with a fresh ADCV in the measurement mode, so the reads
+     * that follow see the same kind of data they would have anyway. In BURST mode the next read starts its own
+     * ADCV, so that one is left out.
+     * Only runs at a frame boundary, so that ADCV never lands between the cell groups of one frame: always in
+     * BURST mode, at is_cycle_start() in ROUND_ROBIN, and in WEIGHTED mode while no CV group has been read since
+     * the last ADCV. The budget is charged from after the wait for the conversion in flight
+     * @return the diagnostic that ran, NUM_DIAGNOSTICS if none did
+     */
+    BMSDiagnostic_e run_diagnostics_slot(uint32_t slot_us);
+
+    const BMSDiagnosticsData &get_diagnostics_data() const { return _diagnostics; }
+
+    const DiagnosticsSlotStats_s &get_diagnostics_stats() const { return _diagnostics_scheduler.get_stats(); }
 
     /* -------------------- WRITING DATA FUNCTIONS -------------------- */
 
     /**
      * Writes the device configuration
      * @pre needs access to undervoltage, overvoltage, configuration MACROS, and discharge data
-     * @post sends packaged data over SPI
+     * @post sends packaged data over SPI, but only to chip selects whose chips don't already hold this
+     * configuration (or are due a refresh, see config_refresh_period_us). Every config_verify_interval_writes
+     * writes the chip select is read back, and rewritten if the chips didn't latch it
      */
     void write_configuration(uint8_t dcto_mode, const std::array<uint16_t, num_chips> &cell_balance_statuses);
 
@@ -250,13 +570,42 @@ public:
         return _current_read_group;
     }
 
+    /**
+     * @brief Switch between round-robin, burst and weighted acquisition, takes effect on the next read_data() call
+     * @note start_read_data_async() always reads a single group, regardless of the mode
+     */
+    void set_acquisition_mode(AcquisitionMode_e mode) {
+        _acquisition_mode = mode;
+    }
+
+    AcquisitionMode_e get_acquisition_mode() {
+        return _acquisition_mode;
+    }
+
+    /**
+     * @brief Request an ADC mode for both the cell and GPIO conversions
+     * @note Applied when the next frame's first conversion is started, so a frame never mixes modes. Reads wait
+     * out the conversion time of the mode (ADC_CONVERSION_TIME_MS_BY_MODE), FILTERED needs ~200 ms between reads
+     */
+    void set_adc_mode(ADC_MODE_e mode) {
+        _requested_adc_mode_cv = static_cast<uint8_t>(mode);
+        _requested_adc_mode_gpio = static_cast<uint8_t>(mode);
+    }
+
+    /**
+     * @return the ADC mode of the cell conversions of the frame being acquired
+     */
+    ADC_MODE_e get_adc_mode() {
+        return static_cast<ADC_MODE_e>(_adc_mode_cv);
+    }
+
     /**
      * @brief Check if the next read_data() call will start a new cycle
-     * @return true if next call reads GROUP_A (starts new ADC conversion cycle)
+     * @return true if next call reads GROUP_A of the cycle's first CV sweep (starts new ADC conversion cycle)
      * @note Useful for detecting cycle boundaries and synchronization points
      */
     bool is_cycle_start() {
-        return _current_read_group == ReadGroup_e::CV_GROUP_A;
+        return _current_read_group == ReadGroup_e::CV_GROUP_A && _cv_sweeps_in_cycle == 0;
     }
 
     /**
@@ -268,12 +617,12 @@ public:
 
     /**
      * @brief Get validity status for all chips from last read
-     * @return Const reference to validity data array (no copy overhead)
+     * @return Const reference to validity data array of the published snapshot (no copy overhead)
      * @note Each chip has 6 validity flags (cells 1-3, 4-6, 7-9, 10-12, GPIO 1-3, 4-6)
      * @note Useful for fault detection and EMI resilience monitoring
      */
     const std::array<ValidPacketData_s, num_chips>& get_validity_data() {
-        return _bms_data.valid_read_packets;
+        return get_bms_data().valid_read_packets;
     }
 
     /**
@@ -309,6 +658,86 @@ public:
         return _config;
     }
 
+    /**
+     * @brief Get how many wakeups were sent (full or isoSPI only) versus skipped
+     * @return Const reference to the running wakeup counters
+     * @note Useful for checking how much busy-waiting the idle tracking is saving
+     */
+    const WakeupStats_s& get_wakeup_stats() {
+        return _wakeup_stats;
+    }
+
+    /**
+     * @brief Get how many CFGR writes were sent versus skipped thanks to the shadow configuration
+     * @return Const reference to the running config write counters
+     */
+    const ConfigWriteStats_s& get_config_write_stats() {
+        return _config_write_stats;
+    }
+
+    /**
+     * @brief Get the measured ADC conversion latency (only updated with poll_adc_status enabled)
+     * @return Const reference to the conversion latency stats
+     */
+    const ConversionLatencyStats_s& get_conversion_latency_stats() {
+        return _conversion_latency_stats;
+    }
+
+    /**
+     * @brief Get the windowed conversion start to read complete latency of the register group reads
+     * @return Const reference to the acquisition latency stats
+     */
+    const AcquisitionLatencyStats_s& get_acquisition_latency_stats() {
+        return _acquisition_latency_stats;
+    }
+
+    /**
+     * @return how old the published voltage of cell is at now_us, counted from the start of the conversion
+     * that produced it
+     */
+    uint32_t get_cell_voltage_age_us(size_t cell, uint32_t now_us) const;
+
+    /**
+     * @return how old the published temperature of thermistor is at now_us, counted like the cell voltages
+     */
+    uint32_t get_cell_temperature_age_us(size_t thermistor, uint32_t now_us) const;
+
+    /**
+     * @brief Get how often PEC-failed groups were re-read and how many chips that recovered
+     * @return Const reference to the running retry counters
+     */
+    const PECRetryStats_s& get_pec_retry_stats() {
+        return _pec_retry_stats;
+    }
+
+    /**
+     * @brief Get how often each register group was read in weighted acquisition
+     * @return Const reference to the scheduler's visit counters, untouched by the other modes
+     */
+    const GroupVisitStats_s& get_group_visit_stats() {
+        return _group_scheduler.get_visit_stats();
+    }
+
+    /**
+     * @return share of the weighted mode reads that went to group
+     */
+    float get_group_visit_frequency(ReadGroup_e group) {
+        return _group_scheduler.get_visit_frequency(group);
+    }
+
+    /**
+     * @brief Set the SPI clock of one chip select (isoSPI segment), used from its next transfer on
+     * @param cs index into the chip select array, not the pin
+     * @note capped at the isoSPI limit, ltc_spi_interface::DEFAULT_SPI_CLOCK_HZ
+     */
+    void set_spi_clock(size_t cs, uint32_t clock_hz) {
+        ltc_spi_interface::set_spi_clock(_chip_select[cs], clock_hz);
+    }
+
+    uint32_t get_spi_clock(size_t cs) {
+        return ltc_spi_interface::get_spi_clock(_chip_select[cs]);
+    }
+
 private:
 
     ReadGroup_e _current_read_group = ReadGroup_e::CV_GROUP_A;
@@ -333,7 +762,143 @@ private:
 
     void _start_wakeup_protocol(size_t cs);
 
-    BMSDriverData _read_data_through_broadcast();
+    /**
+     * Decides how the chip select needs to be woken at at_us and counts it in the wakeup stats
+     * @return the low / high time of each pulse, 0 if the ports are still READY and no pulse is needed
+     */
+    uint32_t _select_wakeup_pulse_us(size_t cs, uint32_t at_us);
+
+    /**
+     * Records that the isoSPI port on this chip select just finished a transaction.
+     * Every transfer keeps the ports READY for another t_IDLE and the cores awake for another t_SLEEP.
+     */
+    void _mark_bus_activity(size_t cs);
+
+    void _mark_bus_activity(size_t cs, uint32_t at_us);
+
+    /**
+     * Stamps groups first_group ... last_group with the conversion that just went out on every chip select
+     */
+    void _record_conversion_start(ReadGroup_e first_group, ReadGroup_e last_group);
+
+    /**
+     * Stamps the current group's capture time on chip select cs and adds its latency to the statistics window
+     */
+    void _record_group_capture(size_t cs);
+
+    void _read_data_through_broadcast();
+
+    /**
+     * BURST acquisition: ADCV, ADAX, then all six groups back to back. The cell groups are read while the
+     * GPIO conversion is still running, so the only waits are for the conversions themselves.
+     */
+    void _read_data_burst();
+
+    /**
+     * Blocks until the conversion started at start_us is done: by PLADC polling if poll_adc_status is set,
+     * otherwise by waiting out the configured conversion time.
+     * Polling gives up poll_timeout_margin_ms past the conversion time (a chip that never reports done, a broken
+     * isoSPI link), drops the pending conversion and counts it in conversion_timeouts
+     * @return false on a timeout, the registers the conversion was meant to fill must not be trusted
+     */
+    bool _wait_for_conversion(uint32_t start_us, float conversion_time_ms);
+
+    /**
+     * Marks the current read group invalid on every chip select and moves past it without reading it
+     */
+    void _skip_group_read();
+
+    /**
+     * Checks the PEC and loads the data of the chips in chip_mask on one chip select for the current read group.
+     * The validity flags of chips outside chip_mask are left alone.
+     * @return bit n set if chip n on the chip select is in chip_mask and read a valid packet
+     */
+    uint32_t _decode_group_response(size_t cs, const std::array<uint8_t, 8 * (num_chips / num_chip_selects)> &spi_data, uint32_t chip_mask = all_chips_on_cs_mask);
+
+    /**
+     * Re-reads the current group on one chip select for the chips in failed_mask, until they all read valid or
+     * the retry budget of this read_data() call runs out. The async path re-reads through the DMA instead, see
+     * finish_read_data_async(). Only called before the next conversion is started,
+     * so the registers still hold the same result the first read saw.
+     */
+    void _retry_failed_group_read(size_t cs, uint32_t failed_mask);
+
+    /**
+     * @return the ValidPacketData_s flag for one chip and read group
+     */
+    bool &_group_validity(size_t chip_index, ReadGroup_e group);
+
+    /**
+     * Marks every chip on one chip select invalid for the current read group (no response was clocked in)
+     */
+    void _invalidate_group_response(size_t cs);
+
+    /**
+     * Publishes totals / extremes for the group that was just read and advances to the next read group
+     */
+    void _finish_group_read();
+
+    /**
+     * Starts the cell / GPIO ADC conversions once the read cycle gets to the groups that need them
+     */
+    void _trigger_ADC_conversions();
+
+    /**
+     * Starts the ADCVAX _trigger_ADC_conversions() held back until the ADAX ahead of it was done, only call once
+     * that conversion is ready
+     * @return true if it started one, the group is read on a later call
+     */
+    bool _start_pending_combined_conversion();
+
+    /**
+     * Weighted mode version of _trigger_ADC_conversions(): an ADCV / ADAX only once the next group has already
+     * been read since the last one of its kind, so no conversion is thrown away before its groups were read
+     */
+    void _trigger_weighted_ADC_conversions();
+
+    /**
+     * Marks the CV groups holding the min and max cell and the AUX group holding the hottest thermistor as hot
+     */
+    void _update_hot_groups();
+
+    /**
+     * @return true if a diagnostic's trailing ADCV would not split a frame, see run_diagnostics_slot()
+     */
+    bool _at_frame_boundary() const;
+
+    /**
+     * The diagnostics run_diagnostics_slot() picks from, each starting with no conversion in flight
+     */
+    void _run_open_wire_check();
+    void _run_mux_self_test();
+    void _run_cell_sc_cross_check();
+
+    /**
+     * Reads CV groups A-D on every chip select into per chip cell codes
+     * @return bit per chip, set if all four groups passed PEC
+     */
+    uint32_t _read_all_cell_codes(std::array<std::array<uint16_t, 12>, num_chips> &cell_codes);
+
+    /**
+     * @return conversion time of the diagnostic ADC mode
+     */
+    float _diagnostic_conversion_time_ms() const;
+
+    /**
+     * Puts a measurement ADCV back after a diagnostic that left its own results in the cell registers, unless the
+     * next read starts one anyway (BURST)
+     */
+    void _restore_cell_voltage_conversion();
+
+    /**
+     * What each diagnostic is expected to take before it first ran, from its conversions plus the reads
+     */
+    std::array<uint32_t, NUM_BMS_DIAGNOSTICS> _initial_diagnostic_durations_us() const;
+
+    /**
+     * Blocks until any DMA transfer on SPI1 is done, so blocking SPI1 traffic never interleaves with it
+     */
+    void _wait_for_async_transfer();
 
     /**
      * REFERENCE ONLY: LTC6811-2 ADDRESS MODE IS BROKEN AND UNUSED
@@ -357,13 +922,72 @@ private:
      * PRODUCTION: All production code uses LTC6811_1 (broadcast mode) exclusively.
      * See ACU_InterfaceTasks.cpp lines 27-28.
      */
-    BMSDriverData _read_data_through_address();
+    void _read_data_through_address();
+
+    void _store_temperature_humidity_data(BMSDriverData &bms_data, const uint16_t &gpio_in, uint8_t gpio_index, uint8_t chip_index);
+
+    void _store_voltage_data(BMSDriverData &bms_data, ReferenceMaxMin_s &max_min_reference, uint16_t voltage_code, uint8_t cell_index);
+
+    /**
+     * Copies the current extremes and their ids out of the min / max trees into _bms_data. Cell voltage,
+     * thermistor temperature (below full scale) and MCP9701 temperature all rise with their code, so the trees
+     * compare codes and only the extremes are converted
+     */
+    void _update_extremes();
+
+    /**
+     * Averages the cell temperatures over converted values, the thermistor curve is not linear
+     */
+    void _update_average_cell_temperature();
+
+    /**
+     * @return the first 4 bytes of CFGR (GPIO pulldowns, REFON, ADCOPT, VUV, VOV), the same for every chip
+     */
+    std::array<uint8_t, 6> _build_config_register_prefix();
+
+    /**
+     * Rebuilds _config_requested from the config prefix, _dcto_mode and _cell_discharge_en
+     */
+    void _update_requested_config();
+
+    /**
+     * @return the WRCFGA payload (requested register + PEC per chip, last chip in the chain first) for one chip select
+     */
+    std::array<uint8_t, 8 * (num_chips / num_chip_selects)> _build_config_payload(size_t cs);
+
+    /**
+     * @return true if, going by the shadow alone, the chips on this chip select hold _config_requested at at_us:
+     * it was written, matches the shadow and the cores haven't slept since
+     */
+    bool _config_shadow_current(size_t cs, uint32_t at_us);
+
+    /**
+     * @return true if the chips on this chip select may not hold _config_requested at at_us: it differs from the
+     * shadow, the shadow was never written / lost to a core sleep, or the refresh period ran out
+     */
+    bool _config_write_needed(size_t cs, uint32_t at_us);
+
+    /**
+     * Records that _config_requested was (or is about to be) written to every chip on this chip select
+     */
+    void _commit_config_shadow(size_t cs, uint32_t at_us);
 
-    void _store_temperature_humidity_data(BMSDriverData &bms_data, ReferenceMaxMin_s &max_min_reference, const uint16_t &gpio_in, uint8_t gpio_index, uint8_t chip_index);
+    /**
+     * Blocking WRCFGA on one chip select, skipped if _config_write_needed() says the chips are up to date, or if
+     * only the refresh is due and a read back shows the chips still hold it
+     */
+    void _write_config_if_needed(size_t cs);
 
-    void _store_voltage_data(BMSDriverData &bms_data, ReferenceMaxMin_s &max_min_reference, volt voltage_in, uint8_t cell_index);
+    /**
+     * Blocking WRCFGA of _config_requested on one chip select
+     */
+    void _write_config(size_t cs);
 
-    void _write_config_through_broadcast(uint8_t dcto_mode, std::array<uint8_t, 6> buffer_format, const std::array<uint16_t, num_chips> &cell_balance_statuses);
+    /**
+     * Blocking RDCFG on one chip select
+     * @return true if every chip read back _config_requested with a valid PEC
+     */
+    bool _verify_config(size_t cs);
 
     void _write_config_through_address(uint8_t dcto_mode, const std::array<uint8_t, 6>& buffer_format, const std::array<uint16_t, num_chips> &cell_balance_statuses);
 
@@ -380,23 +1004,55 @@ private:
      */
     void _start_GPIO_ADC_conversion();
 
-    void _start_ADC_conversion_through_broadcast(const std::array<uint8_t, 2> &cmd_code);
+    /**
+     * Writes command to start the combined cell + GPIO1/GPIO2 ADC conversion (ADCVAX)
+     * @post cells and the first two thermistors of every chip are converted on the same timestamp
+     */
+    void _start_cell_and_GPIO_ADC_conversion();
+
+    /**
+     * With poll_adc_status enabled, sends PLADC on every chip select while a conversion is pending and
+     * records its latency once the whole stack reports done. Otherwise checks the conversion time has passed
+     * @return true if the next group can be read, false if a conversion is still running
+     */
+    bool _conversion_ready_for_read();
+
+    /**
+     * Switches to the ADC modes requested by set_adc_mode(), called right before a frame's first conversion
+     */
+    void _apply_requested_adc_modes();
+
+    /**
+     * @return conversion time of the active cell / GPIO mode: the configured time in the configured mode,
+     * ADC_CONVERSION_TIME_MS_BY_MODE otherwise
+     */
+    float _cv_conversion_time_ms();
+    float _gpio_conversion_time_ms();
+
+    /**
+     * @return ADSTAT (SC only) time in ADC mode md: the configured time in the configured cell mode,
+     * STATUS_ADC_CONVERSION_TIME_MS_BY_MODE otherwise
+     */
+    float _status_conversion_time_ms(uint8_t md) const;
+
+    void _start_ADC_conversion_through_broadcast(const std::array<uint8_t, 4> &cmd_and_pec);
 
     void _start_ADC_conversion_through_address(const std::array<uint8_t, 2>& cmd_code);
 
     void _load_cell_voltages(BMSDriverData &bms_data, ReferenceMaxMin_s &max_min_ref, const std::array<uint8_t, 6> &data_in_cv_group,
                                       uint8_t chip_index, uint8_t start_cell_index);
 
-    void _load_auxillaries(BMSDriverData &bms_data, ReferenceMaxMin_s &max_min_ref, const std::array<uint8_t, 6> &data_in_gpio_group,
+    void _load_auxillaries(BMSDriverData &bms_data, const std::array<uint8_t, 6> &data_in_gpio_group,
                                     uint8_t chip_index, uint8_t start_gpio_index);
 
     /* -------------------- GETTER FUNCTIONS -------------------- */
 
     /**
      * @brief When the inverters are idle, comms get funky from EMI. This function allows us to determine if the acu reads valid packets
-     * @return bool of whether the PEC correctly reflects the buffer being given. If no, then we know that EMI (likely) is causing invalid reads
+     * Checks every chip's PEC in one chip select's response in a single pass
+     * @return bit n set if chip n on the chip select read a valid packet. If not, then we know that EMI (likely) is causing invalid reads
      */
-    bool _check_if_valid_packet(const std::array<uint8_t, 8 * (num_chips / num_chip_selects)> &data, size_t param_iterator);
+    uint32_t _get_valid_packet_mask(const std::array<uint8_t, 8 * (num_chips / num_chip_selects)> &data);
 
     /**
      * Generates a Packet Error Code
@@ -435,14 +1091,43 @@ private:
      */
     constexpr std::array<uint16_t, 256> _initialize_Pec_Table();
 
+    /**
+     * Copies the working data into the back snapshot buffer, then makes it the front one
+     */
+    void _publish_bms_data();
+
     /* MEMBER VARIABLES */
-    BMSDriverData _bms_data;
+    BMSDriverData _bms_data; // Working copy the reads decode into, readers only ever see published snapshots
+
+    /**
+     * Double buffered published reads, _front_snapshot is the latest
+     */
+    std::array<BMSDriverSnapshot, 2> _snapshots = {};
+    size_t _front_snapshot = 0;
+    uint8_t _groups_read_since_publish = 0;
 
     /**
-     * Tracks min/max/sum values across all 6 read groups within a single timestamp cycle.
-     * Reset only at the start of each new cycle (when _current_read_group == CURRENT_GROUP_A).
+     * Running sum of the cell voltage codes, kept up to date with every stored cell
      */
     ReferenceMaxMin_s _max_min_reference;
+
+    /**
+     * Exact extremes over the latest good code of every cell / thermistor / board sensor, whichever group last
+     * updated them. Sensors not read yet (and thermistors at full scale) are absent
+     */
+    MinMaxTree<uint16_t, num_cells> _cell_voltage_extremes;
+    MinMaxTree<uint16_t, num_cell_temps> _thermistor_extremes;
+    MinMaxTree<uint16_t, num_chips> _board_temp_extremes;
+
+    /**
+     * Comparator flags from the last read_cell_voltage_flags()
+     */
+    BMSCellVoltageFlags _cell_voltage_flags = {};
+
+    /**
+     * Sums from the last read_sum_of_cells()
+     */
+    BMSSumOfCellsData _sum_of_cells = {};
     
     /**
      * We will need this for both models of the IC
@@ -481,6 +1166,17 @@ private:
      */
     // uint16_t _pec15Table[256];
     const std::array<uint16_t, 256> _pec15Table; //must be below _config to be initialized after it
+
+    /**
+     * _pec15Table extended to 16 bits per step, used to check the PECs of every response we read
+     */
+    const ltc_command_frames::PEC15SliceTable _pec15_slice_table; //must be below _pec15Table to be initialized after it
+
+    /**
+     * Every broadcast command frame (CMD + PEC) we send, built once from _pec15Table and _config
+     * so the read / write / ADC start paths never have to calculate a command PEC at runtime
+     */
+    const ltc_command_frames::CommandFrameTable_s _command_frames; //must be below _pec15Table to be initialized after it
     
     /**
      * Stores the balance statuses for all the chips
@@ -488,6 +1184,136 @@ private:
      * out of the 16 bits
      */
     std::array<uint16_t, num_chips> _cell_discharge_en = {}; // not const  
+
+    /**
+     * micros() at the end of the last transaction on each chip select, used to decide whether
+     * the isoSPI ports / cores need a wakeup before the next one
+     */
+    std::array<uint32_t, num_chip_selects> _last_bus_activity_us = {};
+
+    /**
+     * False until the first transaction on each chip select, so the first wakeup is always a full one
+     */
+    std::array<bool, num_chip_selects> _bus_activity_seen = {};
+
+    WakeupStats_s _wakeup_stats = {};
+
+    /**
+     * Number of read cycles started, used to space out the GPIO3-5 conversions in combined conversion mode
+     */
+    uint32_t _conversion_cycle_count = 0;
+
+    /**
+     * Combined conversion mode: an ADAX is converting and the cycle's ADCVAX goes out once it is done
+     */
+    bool _combined_conversion_pending = false;
+
+    /**
+     * Set by every ADC start, cleared once PLADC reports the conversion done
+     */
+    bool _conversion_pending = false;
+    uint32_t _conversion_start_us = 0;
+    float _conversion_time_ms = 0; // of the latest conversion, what reads wait out without poll_adc_status
+    uint32_t _cv_conversion_start_us = 0;
+
+    /**
+     * When the latest conversion command went out on each chip select, and from that the oldest conversion behind
+     * each group's registers. Copied into the data's group_capture_times when a group is read
+     */
+    std::array<uint32_t, num_chip_selects> _cs_conversion_start_us = {};
+    std::array<std::array<uint32_t, num_chip_selects>, ReadGroup_e::NUM_GROUPS> _group_conversion_start_us = {};
+
+    /**
+     * Acquisition latency of the window in progress
+     */
+    AcquisitionLatencyStats_s _acquisition_latency_stats = {};
+    uint64_t _latency_window_sum_us = 0;
+    uint32_t _latency_window_min_us = UINT32_MAX;
+    uint32_t _latency_window_max_us = 0;
+    uint16_t _latency_window_samples = 0;
+
+    static constexpr uint32_t all_chips_on_cs_mask = (1UL << Topology::chips_per_cs) - 1;
+
+    /**
+     * Retries left for the current read_data() call or async group read, and what they did
+     */
+    uint8_t _pec_retries_remaining = 0;
+    PECRetryStats_s _pec_retry_stats = {};
+
+    AcquisitionMode_e _acquisition_mode = AcquisitionMode_e::ROUND_ROBIN;
+
+    /**
+     * Round robin: CV sweeps finished in the current cycle, the AUX groups come after cv_sweeps_per_aux_sweep of them
+     */
+    uint8_t _cv_sweeps_in_cycle = 0;
+
+    /**
+     * Weighted mode: picks the group after each read, and which groups (bit per ReadGroup_e) were read since the
+     * last conversion of their kind. A conversion is only started once the group about to be read was already read
+     */
+    GroupReadScheduler _group_scheduler;
+    uint8_t _groups_read_since_conversion = 0;
+
+    /**
+     * Background diagnostics: what to run when, and what they found. Below _config, built from it
+     */
+    DiagnosticsSlotScheduler _diagnostics_scheduler;
+    BMSDiagnosticsData _diagnostics = {};
+
+    /**
+     * ADC modes of the conversions being started, and the ones set_adc_mode() asked for from the next frame on
+     */
+    uint8_t _adc_mode_cv = 0;
+    uint8_t _adc_mode_gpio = 0;
+    uint8_t _requested_adc_mode_cv = 0;
+    uint8_t _requested_adc_mode_gpio = 0;
+    ConversionLatencyStats_s _conversion_latency_stats = {};
+
+    /**
+     * DCTO requested by the last write_configuration(), applied together with _cell_discharge_en
+     */
+    uint8_t _dcto_mode = 0;
+
+    /**
+     * CFGR (6 bytes, no PEC) per chip as requested by the last write_configuration()
+     */
+    std::array<std::array<uint8_t, 6>, num_chips> _config_requested = {};
+
+    /**
+     * CFGR per chip as last written over SPI. Chips only get rewritten when this differs from _config_requested
+     */
+    std::array<std::array<uint8_t, 6>, num_chips> _config_shadow = {};
+
+    std::array<bool, num_chip_selects> _config_shadow_valid = {};
+
+    std::array<uint32_t, num_chip_selects> _last_config_write_us = {}; // or the last read back that confirmed it, for the refresh
+
+    std::array<uint8_t, num_chip_selects> _config_writes_since_verify = {};
+
+    ConfigWriteStats_s _config_write_stats = {};
+
+    /**
+     * Sequencer for start_read_data_async(). Per chip select: wakeup pulses, a WRCFGA frame if the shadow
+     * configuration says it is needed, and a register group read frame
+     */
+    ltc_spi_interface::AsyncTransferEngine<ltc_spi_interface::SPI1DMABackend, 4 + (8 * (num_chips / num_chip_selects)), 2 * num_chip_selects,
+                                           num_chip_selects * (2 + (3 * num_wakeup_pulses))> _async_transfer;
+
+    /**
+     * Where each chip select's frames landed in the _async_transfer queue
+     */
+    std::array<bool, num_chip_selects> _async_config_frame_queued = {};
+    std::array<size_t, num_chip_selects> _async_config_frame_index = {};
+    std::array<size_t, num_chip_selects> _async_read_frame_index = {};
+
+    /**
+     * Async PEC retries of the current group, bit per chip on the chip select: the chips that failed its first read,
+     * the ones still failed, and which chip selects the transfer in flight re-reads
+     */
+    std::array<uint32_t, num_chip_selects> _async_first_failed_mask = {};
+    std::array<uint32_t, num_chip_selects> _async_failed_mask = {};
+    std::array<bool, num_chip_selects> _async_retry_queued = {};
+    bool _async_retry_pending = false;
 };
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
@@ -28,13 +28,38 @@ BMSDriverGroup<num_chips, num_chip_selects, chip_type>::BMSDriverGroup(const std
                                                                             .CRC15_POLY = bms_driver_defaults::CRC15_POLY,
                                                                             .cv_adc_conversion_time_ms = bms_driver_defaults::CV_ADC_CONVERSION_TIME_MS,
                                                                             .gpio_adc_conversion_time_ms = bms_driver_defaults::GPIO_ADC_CONVERSION_TIME_MS,
-                                                                            .cv_adc_lsb_voltage = bms_driver_defaults::CV_ADC_LSB_VOLTAGE
+                                                                            .status_adc_conversion_time_ms = bms_driver_defaults::STATUS_ADC_CONVERSION_TIME_MS,
+                                                                            .isospi_idle_timeout_us = bms_driver_defaults::ISOSPI_IDLE_TIMEOUT_US,
+                                                                            .core_sleep_timeout_us = bms_driver_defaults::CORE_SLEEP_TIMEOUT_US,
+                                                                            .config_refresh_period_us = bms_driver_defaults::CONFIG_REFRESH_PERIOD_US,
+                                                                            .config_verify_interval_writes = bms_driver_defaults::CONFIG_VERIFY_INTERVAL_WRITES,
+                                                                            .verify_config_before_refresh = bms_driver_defaults::VERIFY_CONFIG_BEFORE_REFRESH,
+                                                                            .combined_cv_gpio_conversion = bms_driver_defaults::COMBINED_CV_GPIO_CONVERSION,
+                                                                            .combined_mode_full_gpio_interval = bms_driver_defaults::COMBINED_MODE_FULL_GPIO_INTERVAL,
+                                                                            .cv_sweeps_per_aux_sweep = bms_driver_defaults::CV_SWEEPS_PER_AUX_SWEEP,
+                                                                            .poll_adc_status = bms_driver_defaults::POLL_ADC_STATUS,
+                                                                            .poll_timeout_margin_ms = bms_driver_defaults::POLL_TIMEOUT_MARGIN_MS,
+                                                                            .pec_retry_budget_per_read = bms_driver_defaults::PEC_RETRY_BUDGET_PER_READ,
+                                                                            .acquisition_latency_window = bms_driver_defaults::ACQUISITION_LATENCY_WINDOW,
+                                                                            .hot_group_weight = bms_driver_defaults::HOT_GROUP_WEIGHT,
+                                                                            .max_group_staleness_reads = bms_driver_defaults::MAX_GROUP_STALENESS_READS,
+                                                                            .diagnostics_budget_us_per_s = bms_driver_defaults::DIAGNOSTICS_BUDGET_US_PER_S,
+                                                                            .diagnostic_adc_mode = bms_driver_defaults::DIAGNOSTIC_ADC_MODE,
+                                                                            .open_wire_conversions_per_direction = bms_driver_defaults::OPEN_WIRE_CONVERSIONS_PER_DIRECTION,
+                                                                            .mux_diagnostic_time_ms = bms_driver_defaults::MUX_DIAGNOSTIC_TIME_MS,
+                                                                            .sc_cross_check_tolerance_v = bms_driver_defaults::SC_CROSS_CHECK_TOLERANCE_V
                                                                         }
                                                                 ) : _chip_select(cs),
                                                                     _chip_select_per_chip(cs_per_chip),
                                                                     _address(addr),
                                                                     _config(default_params),
-                                                                    _pec15Table(_initialize_Pec_Table()) {}
+                                                                    _pec15Table(_initialize_Pec_Table()),
+                                                                    _pec15_slice_table(ltc_command_frames::make_pec15_slice_table(_pec15Table)),
+                                                                    _command_frames(ltc_command_frames::make_command_frame_table(_pec15Table,
+                                                                                                                                  _config.discharge_permitted,
+                                                                                                                                  _config.adc_conversion_cell_select_mode)),
+                                                                    _group_scheduler(_config.hot_group_weight, _config.max_group_staleness_reads),
+                                                                    _diagnostics_scheduler(_config.diagnostics_budget_us_per_s, _initial_diagnostic_durations_us()) {}
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
 void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::init()
@@ -47,19 +72,27 @@ void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::init()
         pinMode(cs, OUTPUT);
         digitalWrite(cs, HIGH);
     }
-    _bms_data.voltages.fill(0);
-    _bms_data.cell_temperatures.fill(0);
-    _bms_data.board_temperatures.fill(0);
+    _bms_data.voltage_codes.fill(0);
+    _bms_data.cell_temperature_codes.fill(0);
+    _bms_data.board_temperature_codes.fill(0);
     _bms_data.valid_read_packets.fill(ValidPacketData_s{});
+
+    // Nothing has been written yet, so the first access on each chip select writes CFGR
+    _dcto_mode = _config.dcto_read;
+    _update_requested_config();
+    _config_shadow_valid.fill(false);
     _bms_data.total_voltage = 0;
     _max_min_reference = {
-                            .total_voltage = ref_max_min_defaults::TOTAL_VOLTAGE,
-                            .max_cell_voltage = ref_max_min_defaults::MAX_CELL_VOLTAGE,
-                            .min_cell_voltage = ref_max_min_defaults::MIN_CELL_VOLTAGE,
-                            .min_cell_temp = ref_max_min_defaults::MIN_CELL_TEMP,
-                            .max_cell_temp = ref_max_min_defaults::MAX_CELL_TEMP,
-                            .max_board_temp = ref_max_min_defaults::MAX_BOARD_TEMP,
+                            .total_voltage_code = ref_max_min_defaults::TOTAL_VOLTAGE_CODE,
                         };
+    _cell_voltage_extremes.clear();
+    _thermistor_extremes.clear();
+    _board_temp_extremes.clear();
+
+    _adc_mode_cv = _config.adc_mode_cv_conversion;
+    _adc_mode_gpio = _config.adc_mode_gpio_conversion;
+    _requested_adc_mode_cv = _adc_mode_cv;
+    _requested_adc_mode_gpio = _adc_mode_gpio;
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
@@ -74,243 +107,1003 @@ void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_start_wakeup_proto
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
 void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_start_wakeup_protocol(size_t cs)
 {
+    const uint32_t pulse_delay_us = _select_wakeup_pulse_us(cs, micros());
+    if (pulse_delay_us == 0)
+    {
+        return;
+    }
+
     if constexpr (chip_type == LTC6811_Type_e::LTC6811_1)
     {
-        for (size_t pulse_index = 0; pulse_index < ((num_chips + 1) / num_chip_selects); pulse_index++)
+        for (size_t pulse_index = 0; pulse_index < num_wakeup_pulses; pulse_index++)
         {
-            ltc_spi_interface::_write_and_delay_low(_chip_select[cs], 400);
+            ltc_spi_interface::_write_and_delay_low(_chip_select[cs], pulse_delay_us);
             SPI1.transfer16(0);
-            ltc_spi_interface::_write_and_delay_high(_chip_select[cs], 400);
+            ltc_spi_interface::_write_and_delay_high(_chip_select[cs], pulse_delay_us);
         }
     }
     else
     {
-        ltc_spi_interface::_write_and_delay_low(_chip_select[cs], 400);
+        ltc_spi_interface::_write_and_delay_low(_chip_select[cs], pulse_delay_us);
         SPI1.transfer(0);
-        ltc_spi_interface::_write_and_delay_high(_chip_select[cs], 400); // t_wake is 400 microseconds; wait that long to ensure device has turned on.
+        ltc_spi_interface::_write_and_delay_high(_chip_select[cs], pulse_delay_us); // t_wake is 400 microseconds; wait that long to ensure device has turned on.
+    }
+    _mark_bus_activity(cs);
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+uint32_t BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_select_wakeup_pulse_us(size_t cs, uint32_t at_us)
+{
+    // Skip the pulses entirely if the ports on this chip select are known to still be READY
+    uint32_t idle_time_us = at_us - _last_bus_activity_us[cs];
+    if (_bus_activity_seen[cs] && idle_time_us < _config.isospi_idle_timeout_us)
+    {
+        _wakeup_stats.wakeups_skipped++;
+        return 0;
+    }
+
+    // If the cores are still awake, only the isoSPI ports need waking, which takes t_READY instead of t_WAKE
+    if (_bus_activity_seen[cs] && idle_time_us < _config.core_sleep_timeout_us)
+    {
+        _wakeup_stats.isospi_wakeups_sent++;
+        return ltc_wakeup_timing::T_READY_US;
     }
+    _wakeup_stats.full_wakeups_sent++;
+    return ltc_wakeup_timing::T_WAKE_US;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_mark_bus_activity(size_t cs)
+{
+    _mark_bus_activity(cs, micros());
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_mark_bus_activity(size_t cs, uint32_t at_us)
+{
+    _last_bus_activity_us[cs] = at_us;
+    _bus_activity_seen[cs] = true;
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
 constexpr std::array<uint16_t, 256> BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_initialize_Pec_Table()
 {
-    std::array<uint16_t, 256> temp{};
-    // Logic to fill temp
-    for (int i = 0; i < 256; i++)
+    return ltc_command_frames::make_pec15_table(_config.CRC15_POLY);
+}
+
+/* -------------------- READING DATA FUNCTIONS -------------------- */
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+BMSCoreData_s BMSDriverGroup<num_chips, num_chip_selects, chip_type>::get_bms_core_data()
+    {
+        BMSCoreData_s out{};
+        const BMSDriverData &bms_data = get_bms_data();
+
+        // Basic voltages
+        out.min_cell_voltage = bms_data.min_cell_voltage;
+        out.max_cell_voltage = bms_data.max_cell_voltage;
+        // The sum of cells is one coherent measurement, the cell total only once every group has come around
+        out.pack_voltage = (_sum_of_cells.conversion_start_us != 0 && _sum_of_cells.all_valid()) ? _sum_of_cells.pack_voltage() : bms_data.total_voltage;
+
+        // Temps
+        out.max_cell_temp  = bms_data.max_cell_temp;
+        out.min_cell_temp  = bms_data.min_cell_temp;
+        out.max_board_temp = bms_data.max_board_temp;
+
+        // Hardware comparators, only ever set if read_cell_voltage_flags() is used
+        out.cell_ov_flagged = _cell_voltage_flags.any_over_voltage();
+        out.cell_uv_flagged = _cell_voltage_flags.any_under_voltage();
+
+        return out;
+    }
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+const typename BMSDriverGroup<num_chips, num_chip_selects, chip_type>::BMSDriverData &
+BMSDriverGroup<num_chips, num_chip_selects, chip_type>::read_data()
+{
+    _pec_retries_remaining = _config.pec_retry_budget_per_read;
+
+    if (chip_type == LTC6811_Type_e::LTC6811_1 && _acquisition_mode == AcquisitionMode_e::BURST)
+    {
+        _read_data_burst();
+        _publish_bms_data();
+        return get_bms_data();
+    }
+
+    if (!_conversion_ready_for_read() || _start_pending_combined_conversion())
+    {
+        return get_bms_data(); // Nothing read, the group stays the same and is tried again next call
+    }
+
+    if constexpr (chip_type == LTC6811_Type_e::LTC6811_1)
+    {
+        _read_data_through_broadcast();
+    }
+    else
+    {
+        _read_data_through_address();
+    }
+
+    _trigger_ADC_conversions();
+    _publish_bms_data();
+
+    return get_bms_data();
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_publish_bms_data()
+{
+    const size_t back_snapshot = 1 - _front_snapshot;
+    _snapshots[back_snapshot].data = _bms_data;
+    _snapshots[back_snapshot].sequence = _snapshots[_front_snapshot].sequence + 1;
+    _snapshots[back_snapshot].published_us = micros();
+    _snapshots[back_snapshot].read_groups = _groups_read_since_publish;
+    _groups_read_since_publish = 0;
+    _front_snapshot = back_snapshot;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_trigger_ADC_conversions()
+{
+    if (_acquisition_mode == AcquisitionMode_e::WEIGHTED)
+    {
+        _trigger_weighted_ADC_conversions();
+        return;
+    }
+
+    if (_config.combined_cv_gpio_conversion)
     {
-        uint16_t remainder = i << 7;
-        for (int bit = 8; bit > 0; --bit)
+        // One ADCVAX before group A puts every cell and GPIO1-2 on the same timestamp. ADCVAX doesn't convert
+        // GPIO3-5 though (2 thermistors + the board temp), so those still get an ADAX every few cycles
+        if (_current_read_group == ReadGroup_e::CV_GROUP_A && _cv_sweeps_in_cycle > 0)
+        {
+            // Further CV sweeps of the cycle only need the cells, a plain ADCV is shorter than ADCVAX
+            _apply_requested_adc_modes();
+            _start_cell_voltage_ADC_conversion();
+        }
+        else if (_current_read_group == ReadGroup_e::CV_GROUP_A)
         {
-            if (remainder & 0x4000)
+            _apply_requested_adc_modes();
+            _conversion_cycle_count++;
+            const uint8_t full_gpio_interval = std::max<uint8_t>(_config.combined_mode_full_gpio_interval, 1);
+            if ((_conversion_cycle_count % full_gpio_interval) == 0)
             {
-                remainder = ((remainder << 1));
-                remainder = (remainder ^ _config.CRC15_POLY);
+                // ADAX converts GPIO1-2 as well, so it goes first and the ADCVAX after it leaves them on the cells'
+                // timestamp. The ADCVAX waits for the ADAX to finish, see _start_pending_combined_conversion()
+                _start_GPIO_ADC_conversion();
+                _combined_conversion_pending = true;
             }
             else
             {
-                remainder = ((remainder << 1));
+                _start_cell_and_GPIO_ADC_conversion();
             }
         }
-        temp[i] = remainder & 0xFFFF;
+        return;
+    }
+
+    // Trigger ADC conversions at the start of each complete 6-group read cycle
+    // This ensures all groups (A, B, C, D, AUX_A, AUX_B) read from the same timestamp
+    // The ADAX of a frame follows its ADCV, so the mode only changes at the ADCV
+    if (_current_read_group == ReadGroup_e::AUX_GROUP_A)
+    {
+        _apply_requested_adc_modes();
+        _start_cell_voltage_ADC_conversion();
+    }
+    if (_current_read_group == ReadGroup_e::CV_GROUP_A && _cv_sweeps_in_cycle == 0)
+    {
+        _start_GPIO_ADC_conversion();
+    }
+    // Every further CV sweep of the cycle gets its own ADCV, the GPIO registers keep the cycle's ADAX until AUX_A
+    if (_current_read_group == ReadGroup_e::CV_GROUP_A && _cv_sweeps_in_cycle > 0)
+    {
+        _apply_requested_adc_modes();
+        _start_cell_voltage_ADC_conversion();
     }
-    return temp;
 }
 
-/* -------------------- READING DATA FUNCTIONS -------------------- */
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_start_pending_combined_conversion()
+{
+    if (!_combined_conversion_pending)
+    {
+        return false;
+    }
+    _combined_conversion_pending = false;
+    _start_cell_and_GPIO_ADC_conversion();
+    return true;
+}
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-BMSCoreData_s BMSDriverGroup<num_chips, num_chip_selects, chip_type>::get_bms_core_data()
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_trigger_weighted_ADC_conversions()
+{
+    // Combined ADCVAX is not used here: the CV and AUX groups are no longer read in step with each other
+    constexpr uint8_t cv_groups_mask = (1U << (ReadGroup_e::CV_GROUP_D + 1)) - 1;
+    constexpr uint8_t aux_groups_mask = (1U << ReadGroup_e::AUX_GROUP_A) | (1U << ReadGroup_e::AUX_GROUP_B);
+
+    if (((_groups_read_since_conversion >> _current_read_group) & 1U) == 0)
     {
-        BMSCoreData_s out{};
+        return;
+    }
+    if (_current_read_group <= ReadGroup_e::CV_GROUP_D)
+    {
+        _apply_requested_adc_modes();
+        _start_cell_voltage_ADC_conversion();
+        _groups_read_since_conversion &= ~cv_groups_mask;
+    }
+    else
+    {
+        _start_GPIO_ADC_conversion();
+        _groups_read_since_conversion &= ~aux_groups_mask;
+    }
+}
 
-        // Basic voltages
-        out.min_cell_voltage = _bms_data.min_cell_voltage;
-        out.max_cell_voltage = _bms_data.max_cell_voltage;
-        out.pack_voltage = _bms_data.total_voltage; 
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::start_read_data_async()
+{
+    if constexpr (chip_type != LTC6811_Type_e::LTC6811_1)
+    {
+        return false; // Address mode is reference only, it never gets a DMA path
+    }
 
-        // Temps
-        out.max_cell_temp  = _bms_data.max_cell_temp;
-        out.min_cell_temp  = _bms_data.min_cell_temp;
-        out.max_board_temp = _bms_data.max_board_temp;
+    if (_async_transfer.get_state() != ltc_spi_interface::AsyncTransferState_e::IDLE || !_conversion_ready_for_read() ||
+        _start_pending_combined_conversion())
+    {
+        return false;
+    }
+
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+
+    // A retry re-reads the group the last transfer failed on, only on the chip selects that need it
+    const bool retry = _async_retry_pending;
+    if (!retry)
+    {
+        _pec_retries_remaining = _config.pec_retry_budget_per_read;
+    }
+
+    const std::array<uint8_t, 4> &read_cmd_pec = _command_frames.read_group[_current_read_group];
+    std::array<uint8_t, 4 + data_size> write_frame;
+    std::copy_n(_command_frames.write_config.begin(), 4, write_frame.begin());
+
+    // The wakeup decision for each chip select is made for when its steps will actually run, not for now
+    const uint32_t now_us = micros();
+    uint32_t sequence_time_us = 0;
+    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    {
+        _async_retry_queued[cs] = retry && _async_failed_mask[cs] != 0 && _pec_retries_remaining > 0;
+        if (retry && !_async_retry_queued[cs])
+        {
+            _async_config_frame_queued[cs] = false;
+            continue;
+        }
+        if (retry)
+        {
+            _pec_retries_remaining--;
+            _pec_retry_stats.retries_sent++;
+        }
+
+        // Checked before the wakeup / bus activity below, which would otherwise hide a core that went to sleep
+        // Bits at this chip select's SPI clock, plus 5 us chip select setup and hold
+        const uint32_t frame_time_us = static_cast<uint32_t>((static_cast<uint64_t>(4 + data_size) * 8 * 1000000) / get_spi_clock(cs)) + 10;
+        const bool config_write_needed = _config_write_needed(cs, now_us + sequence_time_us);
+        const uint32_t pulse_delay_us = _select_wakeup_pulse_us(cs, now_us + sequence_time_us);
+        if (pulse_delay_us != 0)
+        {
+            _async_transfer.queue_wakeup_pulses(_chip_select[cs], num_wakeup_pulses, pulse_delay_us);
+            sequence_time_us += 2 * pulse_delay_us * num_wakeup_pulses;
+        }
+
+        _async_config_frame_queued[cs] = config_write_needed;
+        if (config_write_needed)
+        {
+            const std::array<uint8_t, data_size> payload = _build_config_payload(cs);
+            std::copy_n(payload.begin(), data_size, write_frame.begin() + 4);
+            _async_config_frame_index[cs] = _async_transfer.get_num_frames();
+            _async_transfer.queue_frame(_chip_select[cs], write_frame.data(), write_frame.size());
+            // Committed up front; finish_read_data_async() drops the shadow again if the frame never went out
+            _commit_config_shadow(cs, now_us + sequence_time_us);
+            sequence_time_us += frame_time_us;
+        }
+        else
+        {
+            _config_write_stats.config_writes_skipped++;
+        }
+        _async_read_frame_index[cs] = _async_transfer.get_num_frames();
+        _async_transfer.queue_frame(_chip_select[cs], read_cmd_pec.data(), read_cmd_pec.size());
+
+        // Marked at the earliest time the frames can run, so idle time is never underestimated
+        _mark_bus_activity(cs, now_us + sequence_time_us);
+        sequence_time_us += frame_time_us;
+    }
+
+    return _async_transfer.start(now_us);
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::is_async_read_complete()
+{
+    return _async_transfer.get_state() == ltc_spi_interface::AsyncTransferState_e::COMPLETE;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::service_async_read()
+{
+    _async_transfer.service(micros());
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+const typename BMSDriverGroup<num_chips, num_chip_selects, chip_type>::BMSDriverData &
+BMSDriverGroup<num_chips, num_chip_selects, chip_type>::finish_read_data_async()
+{
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+    if (!is_async_read_complete())
+    {
+        return get_bms_data();
+    }
+
+    const bool retry = _async_retry_pending;
+    _async_retry_pending = false;
+
+    std::array<uint8_t, data_size> spi_data;
+    bool any_failed = false;
+    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    {
+        if (_async_config_frame_queued[cs] && _async_config_frame_index[cs] >= _async_transfer.get_num_completed_frames())
+        {
+            _config_shadow_valid[cs] = false;
+        }
+        if (retry && !_async_retry_queued[cs])
+        {
+            any_failed |= _async_failed_mask[cs] != 0;
+            continue;
+        }
+
+        // Chips that were already valid keep their first read
+        const uint32_t chip_mask = retry ? _async_failed_mask[cs] : all_chips_on_cs_mask;
+        uint32_t valid_mask = 0;
+        const size_t read_frame_index = _async_read_frame_index[cs];
+        if (read_frame_index >= _async_transfer.get_num_completed_frames())
+        {
+            if (!retry)
+            {
+                _invalidate_group_response(cs);
+            }
+        }
+        else
+        {
+            // The first 4 bytes were clocked in while CMD + PEC went out
+            std::copy_n(_async_transfer.get_received_frame(read_frame_index).begin() + 4, data_size, spi_data.begin());
+            valid_mask = _decode_group_response(cs, spi_data, chip_mask);
+        }
+        _async_failed_mask[cs] = chip_mask & ~valid_mask;
+        if (!retry)
+        {
+            _async_first_failed_mask[cs] = _async_failed_mask[cs];
+        }
+        any_failed |= _async_failed_mask[cs] != 0;
+    }
+    _async_transfer.release();
+
+    // No conversion was started yet, so the next start_read_data_async() re-reads the same result
+    if (any_failed && _pec_retries_remaining > 0)
+    {
+        _async_retry_pending = true;
+        return get_bms_data();
+    }
+    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    {
+        if (_async_first_failed_mask[cs] == 0)
+        {
+            continue;
+        }
+        _pec_retry_stats.chips_recovered += __builtin_popcount(_async_first_failed_mask[cs] & ~_async_failed_mask[cs]);
+        _pec_retry_stats.chips_not_recovered += __builtin_popcount(_async_failed_mask[cs]);
+        if (_async_failed_mask[cs] != 0)
+        {
+            _pec_retry_stats.retries_out_of_budget++;
+        }
+    }
+
+    _finish_group_read();
+    _trigger_ADC_conversions();
+    _publish_bms_data();
+    return get_bms_data();
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+const typename BMSDriverGroup<num_chips, num_chip_selects, chip_type>::BMSCellVoltageFlags &
+BMSDriverGroup<num_chips, num_chip_selects, chip_type>::read_cell_voltage_flags()
+{
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+    _wait_for_async_transfer();
+    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    {
+        _start_wakeup_protocol(cs);
+        std::array<uint8_t, data_size> spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], _command_frames.read_status_b);
+        _mark_bus_activity(cs);
+
+        const uint32_t valid_packet_mask = _get_valid_packet_mask(spi_data);
+        for (size_t chip = 0; chip < Topology::chips_per_cs; chip++)
+        {
+            const size_t chip_index = Topology::cs_first_chip[cs] + chip;
+            const bool valid = (valid_packet_mask >> chip) & 1U;
+            _cell_voltage_flags.valid[chip_index] = valid;
+            if (!valid)
+            {
+                continue;
+            }
+
+            // Unused inputs of a 9 cell chip sit below VUV, their flags mean nothing
+            const uint16_t cell_mask = static_cast<uint16_t>((1U << Topology::chip_num_cells[chip_index]) - 1);
+            const uint8_t *status_b = spi_data.data() + (8 * chip);
+            _cell_voltage_flags.over_voltage[chip_index] = ltc_command_frames::decode_cell_voltage_flags(status_b, true) & cell_mask;
+            _cell_voltage_flags.under_voltage[chip_index] = ltc_command_frames::decode_cell_voltage_flags(status_b, false) & cell_mask;
+        }
+    }
+    _cell_voltage_flags.read_us = micros();
+    return _cell_voltage_flags;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+const typename BMSDriverGroup<num_chips, num_chip_selects, chip_type>::BMSSumOfCellsData &
+BMSDriverGroup<num_chips, num_chip_selects, chip_type>::read_sum_of_cells()
+{
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+
+    // One ADC per chip: a new start while the cells / GPIOs are still converting would cut that conversion short
+    _wait_for_conversion(_conversion_start_us, _conversion_time_ms);
+
+    _start_ADC_conversion_through_broadcast(_command_frames.start_status_sc_adc[_adc_mode_cv]);
+    _conversion_time_ms = _status_conversion_time_ms(_adc_mode_cv);
+    _sum_of_cells.conversion_start_us = _conversion_start_us;
+    if (!_wait_for_conversion(_conversion_start_us, _conversion_time_ms))
+    {
+        _sum_of_cells.valid.fill(false);
+        return _sum_of_cells;
+    }
+
+    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    {
+        _start_wakeup_protocol(cs);
+        std::array<uint8_t, data_size> spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], _command_frames.read_status_a);
+        _mark_bus_activity(cs);
+
+        const uint32_t valid_packet_mask = _get_valid_packet_mask(spi_data);
+        for (size_t chip = 0; chip < Topology::chips_per_cs; chip++)
+        {
+            const size_t chip_index = Topology::cs_first_chip[cs] + chip;
+            const bool valid = (valid_packet_mask >> chip) & 1U;
+            _sum_of_cells.valid[chip_index] = valid;
+            if (valid)
+            {
+                _sum_of_cells.sum_of_cells_codes[chip_index] = ltc_command_frames::decode_sum_of_cells_code(spi_data.data() + (8 * chip));
+            }
+        }
+    }
+    return _sum_of_cells;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+BMSDiagnostic_e BMSDriverGroup<num_chips, num_chip_selects, chip_type>::run_diagnostics_slot(uint32_t slot_us)
+{
+    constexpr uint8_t cv_groups_mask = (1U << (ReadGroup_e::CV_GROUP_D + 1)) - 1;
+
+    if (!_at_frame_boundary())
+    {
+        return BMSDiagnostic_e::NUM_DIAGNOSTICS;
+    }
+    // The wait for the conversion in flight comes out of the slot before the diagnostic does
+    const uint32_t now_us = micros();
+    const uint32_t conversion_time_us = static_cast<uint32_t>(_conversion_time_ms * 1000.0f);
+    const uint32_t conversion_elapsed_us = now_us - _conversion_start_us;
+    const uint32_t conversion_left_us = (conversion_elapsed_us < conversion_time_us) ? conversion_time_us - conversion_elapsed_us : 0;
+    if (conversion_left_us >= slot_us)
+    {
+        return BMSDiagnostic_e::NUM_DIAGNOSTICS;
+    }
+    const BMSDiagnostic_e diagnostic = _diagnostics_scheduler.next(now_us, slot_us - conversion_left_us);
+    if (diagnostic == BMSDiagnostic_e::NUM_DIAGNOSTICS)
+    {
+        return diagnostic;
+    }
+
+    _wait_for_async_transfer();
+    // One ADC per chip: a diagnostic conversion would cut the measurement in flight short
+    _wait_for_conversion(_conversion_start_us, _conversion_time_ms);
+    const uint32_t start_us = micros();
+
+    switch (diagnostic)
+    {
+        case BMSDiagnostic_e::OPEN_WIRE:
+            _run_open_wire_check();
+            break;
+        case BMSDiagnostic_e::MUX_SELF_TEST:
+            _run_mux_self_test();
+            break;
+        case BMSDiagnostic_e::CELL_SC_CROSS_CHECK:
+            _run_cell_sc_cross_check();
+            break;
+        default:
+            break;
+    }
+    // Nothing was read from the trailing ADCV yet, the weighted trigger must not start another one over it
+    _groups_read_since_conversion &= ~cv_groups_mask;
+
+    _diagnostics.last_run_us[static_cast<size_t>(diagnostic)] = start_us;
+    _diagnostics_scheduler.record_run(diagnostic, micros() - start_us);
+    return diagnostic;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_at_frame_boundary() const
+{
+    constexpr uint8_t cv_groups_mask = (1U << (ReadGroup_e::CV_GROUP_D + 1)) - 1;
+
+    switch (_acquisition_mode)
+    {
+        case AcquisitionMode_e::BURST:
+            return true;
+        case AcquisitionMode_e::WEIGHTED:
+            return (_groups_read_since_conversion & cv_groups_mask) == 0;
+        default:
+            return _current_read_group == ReadGroup_e::CV_GROUP_A && _cv_sweeps_in_cycle == 0;
+    }
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_run_open_wire_check()
+{
+    const uint8_t md = _config.diagnostic_adc_mode & 0x3;
+    const uint8_t conversions = std::max<uint8_t>(_config.open_wire_conversions_per_direction, 1);
+    std::array<std::array<uint16_t, 12>, num_chips> pull_up_codes = {};
+    std::array<std::array<uint16_t, 12>, num_chips> pull_down_codes = {};
+
+    bool converted = true;
+    for (uint8_t conversion = 0; conversion < conversions; conversion++)
+    {
+        _start_ADC_conversion_through_broadcast(_command_frames.start_open_wire_pull_up[md]);
+        _conversion_time_ms = _diagnostic_conversion_time_ms();
+        converted &= _wait_for_conversion(_conversion_start_us, _conversion_time_ms);
+    }
+    uint32_t valid_chips = converted ? _read_all_cell_codes(pull_up_codes) : 0;
+
+    for (uint8_t conversion = 0; converted && conversion < conversions; conversion++)
+    {
+        _start_ADC_conversion_through_broadcast(_command_frames.start_open_wire_pull_down[md]);
+        _conversion_time_ms = _diagnostic_conversion_time_ms();
+        converted &= _wait_for_conversion(_conversion_start_us, _conversion_time_ms);
+    }
+    valid_chips &= converted ? _read_all_cell_codes(pull_down_codes) : 0;
+
+    for (size_t chip = 0; chip < num_chips; chip++)
+    {
+        const bool valid = (valid_chips >> chip) & 1U;
+        _diagnostics.valid[static_cast<size_t>(BMSDiagnostic_e::OPEN_WIRE)][chip] = valid;
+        if (valid)
+        {
+            _diagnostics.open_wires[chip] = ltc_command_frames::decode_open_wires(pull_up_codes[chip], pull_down_codes[chip], Topology::chip_num_cells[chip]);
+        }
+    }
+
+    // The cell registers hold the ADOW results now, put a measurement back before the next read gets to them
+    _restore_cell_voltage_conversion();
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_run_mux_self_test()
+{
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+
+    _start_ADC_conversion_through_broadcast(_command_frames.diagnose_mux);
+    _conversion_time_ms = _config.mux_diagnostic_time_ms;
+    if (!_wait_for_conversion(_conversion_start_us, _conversion_time_ms))
+    {
+        _diagnostics.valid[static_cast<size_t>(BMSDiagnostic_e::MUX_SELF_TEST)].fill(false);
+        return;
+    }
+
+    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    {
+        _start_wakeup_protocol(cs);
+        std::array<uint8_t, data_size> spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], _command_frames.read_status_b);
+        _mark_bus_activity(cs);
+
+        const uint32_t valid_packet_mask = _get_valid_packet_mask(spi_data);
+        for (size_t chip = 0; chip < Topology::chips_per_cs; chip++)
+        {
+            const size_t chip_index = Topology::cs_first_chip[cs] + chip;
+            const bool valid = (valid_packet_mask >> chip) & 1U;
+            _diagnostics.valid[static_cast<size_t>(BMSDiagnostic_e::MUX_SELF_TEST)][chip_index] = valid;
+            if (valid)
+            {
+                _diagnostics.mux_fail[chip_index] = ltc_command_frames::decode_mux_fail(spi_data.data() + (8 * chip));
+                _diagnostics.thermal_shutdown[chip_index] = ltc_command_frames::decode_thermal_shutdown(spi_data.data() + (8 * chip));
+            }
+        }
+    }
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_run_cell_sc_cross_check()
+{
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+    const uint8_t md = _config.diagnostic_adc_mode & 0x3;
+    std::array<std::array<uint16_t, 12>, num_chips> cell_codes = {};
+    std::array<uint16_t, num_chips> sum_of_cells_codes = {};
+
+    _start_ADC_conversion_through_broadcast(_command_frames.start_cv_sc_adc[md]);
+    _conversion_time_ms = _diagnostic_conversion_time_ms() + _status_conversion_time_ms(md);
+    const bool converted = _wait_for_conversion(_conversion_start_us, _conversion_time_ms);
+
+    uint32_t valid_chips = converted ? _read_all_cell_codes(cell_codes) : 0;
+    for (size_t cs = 0; converted && cs < num_chip_selects; cs++)
+    {
+        _start_wakeup_protocol(cs);
+        std::array<uint8_t, data_size> spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], _command_frames.read_status_a);
+        _mark_bus_activity(cs);
+
+        const uint32_t valid_packet_mask = _get_valid_packet_mask(spi_data);
+        for (size_t chip = 0; chip < Topology::chips_per_cs; chip++)
+        {
+            const size_t chip_index = Topology::cs_first_chip[cs] + chip;
+            if (((valid_packet_mask >> chip) & 1U) == 0)
+            {
+                valid_chips &= ~(1UL << chip_index);
+                continue;
+            }
+            sum_of_cells_codes[chip_index] = ltc_command_frames::decode_sum_of_cells_code(spi_data.data() + (8 * chip));
+        }
+    }
+
+    for (size_t chip = 0; chip < num_chips; chip++)
+    {
+        const bool valid = (valid_chips >> chip) & 1U;
+        _diagnostics.valid[static_cast<size_t>(BMSDiagnostic_e::CELL_SC_CROSS_CHECK)][chip] = valid;
+        if (!valid)
+        {
+            continue;
+        }
+        const uint32_t cells_code = std::accumulate(cell_codes[chip].begin(), cell_codes[chip].begin() + Topology::chip_num_cells[chip], 0UL);
+        const float difference_v = (sum_of_cells_codes[chip] * bms_driver_defaults::SC_ADC_LSB_VOLTAGE) - (cells_code * bms_driver_defaults::CV_ADC_LSB_VOLTAGE);
+        _diagnostics.sc_minus_cells_v[chip] = difference_v;
+        _diagnostics.sc_mismatch[chip] = std::fabs(difference_v) > _config.sc_cross_check_tolerance_v;
+    }
+
+    // Valid cell data, but converted in the diagnostic mode, the reads that follow expect the measurement mode
+    _restore_cell_voltage_conversion();
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_restore_cell_voltage_conversion()
+{
+    if (_acquisition_mode != AcquisitionMode_e::BURST)
+    {
+        _start_cell_voltage_ADC_conversion();
+    }
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+uint32_t BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_read_all_cell_codes(std::array<std::array<uint16_t, 12>, num_chips> &cell_codes)
+{
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+    uint32_t valid_chips = (1UL << num_chips) - 1;
+
+    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    {
+        for (int group = ReadGroup_e::CV_GROUP_A; group <= ReadGroup_e::CV_GROUP_D; group++)
+        {
+            _start_wakeup_protocol(cs);
+            std::array<uint8_t, data_size> spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], _command_frames.read_group[group]);
+            _mark_bus_activity(cs);
+
+            const uint32_t valid_packet_mask = _get_valid_packet_mask(spi_data);
+            for (size_t chip = 0; chip < Topology::chips_per_cs; chip++)
+            {
+                const size_t chip_index = Topology::cs_first_chip[cs] + chip;
+                if (((valid_packet_mask >> chip) & 1U) == 0)
+                {
+                    valid_chips &= ~(1UL << chip_index);
+                    continue;
+                }
+                for (size_t slot = 0; slot < bms_pack_layout::CELLS_PER_CV_GROUP; slot++)
+                {
+                    const uint8_t *cell_data = spi_data.data() + (8 * chip) + (2 * slot);
+                    cell_codes[chip_index][(bms_pack_layout::CELLS_PER_CV_GROUP * group) + slot] = static_cast<uint16_t>(cell_data[0] | (cell_data[1] << 8));
+                }
+            }
+        }
+    }
+    return valid_chips;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+float BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_diagnostic_conversion_time_ms() const
+{
+    return bms_driver_defaults::ADC_CONVERSION_TIME_MS_BY_MODE[_config.diagnostic_adc_mode & 0x3];
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+std::array<uint32_t, NUM_BMS_DIAGNOSTICS> BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_initial_diagnostic_durations_us() const
+{
+    constexpr uint32_t reads_us = 2000; // 8 CV group reads at most, a few hundred us each across both chip selects
+    const uint32_t conversion_us = static_cast<uint32_t>(_diagnostic_conversion_time_ms() * 1000.0f);
+    std::array<uint32_t, NUM_BMS_DIAGNOSTICS> durations_us = {};
+    durations_us[static_cast<size_t>(BMSDiagnostic_e::OPEN_WIRE)] = (2 * std::max<uint8_t>(_config.open_wire_conversions_per_direction, 1) * conversion_us) + reads_us;
+    durations_us[static_cast<size_t>(BMSDiagnostic_e::MUX_SELF_TEST)] = static_cast<uint32_t>(_config.mux_diagnostic_time_ms * 1000.0f) + (reads_us / 4);
+    durations_us[static_cast<size_t>(BMSDiagnostic_e::CELL_SC_CROSS_CHECK)] = conversion_us + static_cast<uint32_t>(_status_conversion_time_ms(_config.diagnostic_adc_mode & 0x3) * 1000.0f) + reads_us;
+    return durations_us;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_wait_for_async_transfer()
+{
+    // Only reached if a blocking access races an async read; the read is run to completion here instead
+    while (_async_transfer.get_state() == ltc_spi_interface::AsyncTransferState_e::IN_FLIGHT)
+    {
+        _async_transfer.service(micros());
+    }
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_read_data_through_broadcast()
+{
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+    _wait_for_async_transfer();
+    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    {
+        // Only goes out if the chips may have lost (or never got) the configuration
+        _write_config_if_needed(cs);
+
+        // Get buffers for each group we care about, all at once for ONE chip select line
+        _start_wakeup_protocol(cs);
+
+        std::array<uint8_t, data_size> spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], _command_frames.read_group[_current_read_group]);
+        _mark_bus_activity(cs);
+
+        const uint32_t valid_mask = _decode_group_response(cs, spi_data);
+        if (valid_mask != all_chips_on_cs_mask)
+        {
+            _retry_failed_group_read(cs, all_chips_on_cs_mask & ~valid_mask);
+        }
+    }
+
+    _finish_group_read();
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_retry_failed_group_read(size_t cs, uint32_t failed_mask)
+{
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+    uint32_t still_failed_mask = failed_mask;
+    while (still_failed_mask != 0 && _pec_retries_remaining > 0)
+    {
+        _pec_retries_remaining--;
+        _pec_retry_stats.retries_sent++;
+
+        _start_wakeup_protocol(cs);
+        std::array<uint8_t, data_size> spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], _command_frames.read_group[_current_read_group]);
+        _mark_bus_activity(cs);
+
+        // Chips that were already valid keep their first read
+        still_failed_mask &= ~_decode_group_response(cs, spi_data, still_failed_mask);
+    }
+
+    _pec_retry_stats.chips_recovered += __builtin_popcount(failed_mask & ~still_failed_mask);
+    _pec_retry_stats.chips_not_recovered += __builtin_popcount(still_failed_mask);
+    if (still_failed_mask != 0 && _pec_retries_remaining == 0)
+    {
+        _pec_retry_stats.retries_out_of_budget++;
+    }
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_read_data_burst()
+{
+    _wait_for_async_transfer();
+
+    // Always a whole cycle from group A, so nothing read here predates the conversions below
+    _current_read_group = ReadGroup_e::CV_GROUP_A;
+    _cv_sweeps_in_cycle = 0;
+
+    _apply_requested_adc_modes();
+    _start_cell_voltage_ADC_conversion();
+    const bool cv_converted = _wait_for_conversion(_cv_conversion_start_us, _cv_conversion_time_ms());
+
+    // Cell registers are stable once ADCV is done, so they are read while ADAX runs
+    _start_GPIO_ADC_conversion();
+    const uint32_t gpio_conversion_start_us = _conversion_start_us;
+    for (int group = ReadGroup_e::CV_GROUP_A; group <= ReadGroup_e::CV_GROUP_D; group++)
+    {
+        if (cv_converted)
+        {
+            _read_data_through_broadcast();
+        }
+        else
+        {
+            _skip_group_read();
+        }
+    }
+
+    const bool gpio_converted = _wait_for_conversion(gpio_conversion_start_us, _gpio_conversion_time_ms());
+    for (int group = ReadGroup_e::AUX_GROUP_A; group <= ReadGroup_e::AUX_GROUP_B; group++)
+    {
+        if (gpio_converted)
+        {
+            _read_data_through_broadcast();
+        }
+        else
+        {
+            _skip_group_read();
+        }
+    }
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_wait_for_conversion(uint32_t start_us, float conversion_time_ms)
+{
+    if (_config.poll_adc_status)
+    {
+        const uint32_t timeout_us = static_cast<uint32_t>((conversion_time_ms + _config.poll_timeout_margin_ms) * 1000.0f);
+        while (!_conversion_ready_for_read())
+        {
+            if ((micros() - start_us) >= timeout_us)
+            {
+                _conversion_pending = false;
+                _conversion_latency_stats.conversion_timeouts++;
+                return false;
+            }
+        }
+        return true;
+    }
 
-        return out;
+    const uint32_t conversion_time_us = static_cast<uint32_t>(conversion_time_ms * 1000.0f);
+    const uint32_t elapsed_us = micros() - start_us;
+    if (elapsed_us < conversion_time_us)
+    {
+        delayMicroseconds(conversion_time_us - elapsed_us);
     }
+    return true;
+}
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-typename BMSDriverGroup<num_chips, num_chip_selects, chip_type>::BMSDriverData
-BMSDriverGroup<num_chips, num_chip_selects, chip_type>::get_bms_data()
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_skip_group_read()
 {
-    return _bms_data;
+    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    {
+        _invalidate_group_response(cs);
+    }
+    _finish_group_read();
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-typename BMSDriverGroup<num_chips, num_chip_selects, chip_type>::BMSDriverData
-BMSDriverGroup<num_chips, num_chip_selects, chip_type>::read_data()
+bool &BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_group_validity(size_t chip_index, ReadGroup_e group)
 {
-    BMSDriverData bms_data;
-    if constexpr (chip_type == LTC6811_Type_e::LTC6811_1)
-    {
-        bms_data = _read_data_through_broadcast();
-    }
-    else
-    {
-        bms_data = _read_data_through_address();
-    }
-    
-    // Trigger ADC conversions at the start of each complete 6-group read cycle
-    // This ensures all groups (A, B, C, D, AUX_A, AUX_B) read from the same timestamp
-    if (_current_read_group == ReadGroup_e::AUX_GROUP_A)
-    {
-        _start_cell_voltage_ADC_conversion();
-    }
-    if (_current_read_group == ReadGroup_e::CV_GROUP_A)
-    {
-        _start_GPIO_ADC_conversion();
+    ValidPacketData_s &validity = _bms_data.valid_read_packets[chip_index];
+    switch (group) {
+        case ReadGroup_e::CV_GROUP_A:
+            return validity.valid_read_cells_1_to_3;
+        case ReadGroup_e::CV_GROUP_B:
+            return validity.valid_read_cells_4_to_6;
+        case ReadGroup_e::CV_GROUP_C:
+            return validity.valid_read_cells_7_to_9;
+        case ReadGroup_e::CV_GROUP_D:
+            return validity.valid_read_cells_10_to_12;
+        case ReadGroup_e::AUX_GROUP_A:
+            return validity.valid_read_gpios_1_to_3;
+        case ReadGroup_e::AUX_GROUP_B:
+            return validity.valid_read_gpios_4_to_6;
+        default:
+            // NUM_CURRENT_GROUPS is a sentinel value and should never be reached
+            __builtin_unreachable();
     }
-    
-    return bms_data;
 }
+
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-typename BMSDriverGroup<num_chips, num_chip_selects, chip_type>::BMSDriverData
-BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_read_data_through_broadcast()
+uint32_t BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_decode_group_response(size_t cs, const std::array<uint8_t, 8 * (num_chips / num_chip_selects)> &spi_data, uint32_t chip_mask)
 {
-    constexpr size_t data_size = 8 * (num_chips / num_chip_selects);
-    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    // 3 registers per group: cells 0/3/6/9 for CV groups A-D, GPIOs 0/3 for AUX groups A-B
+    const uint8_t start_index = (_current_read_group <= ReadGroup_e::CV_GROUP_D) ? 3 * _current_read_group : 3 * (_current_read_group - ReadGroup_e::AUX_GROUP_A);
+    const uint32_t valid_packet_mask = _get_valid_packet_mask(spi_data) & chip_mask;
+    if (valid_packet_mask != 0)
     {
-        write_configuration(_config.dcto_read, _cell_discharge_en);
-    
-        std::array<uint8_t, 4> cmd_pec;
-        std::array<uint8_t, data_size> spi_data;
-
-        // Get buffers for each group we care about, all at once for ONE chip select line
-        _start_wakeup_protocol(cs);
+        _record_group_capture(cs);
+    }
 
-        switch (_current_read_group) {
-            case ReadGroup_e::CV_GROUP_A:
-                cmd_pec = _generate_CMD_PEC(CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_A, -1); // The address should never be used here
-                spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], cmd_pec);
-                break;
-            case ReadGroup_e::CV_GROUP_B:
-                cmd_pec = _generate_CMD_PEC(CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_B, -1);
-                spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], cmd_pec);
-                break;
-            case ReadGroup_e::CV_GROUP_C:
-                cmd_pec = _generate_CMD_PEC(CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_C, -1);
-                spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], cmd_pec);
-                break;
-            case ReadGroup_e::CV_GROUP_D:
-                cmd_pec = _generate_CMD_PEC(CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_D, -1);
-                spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], cmd_pec);
-                break;
-            case ReadGroup_e::AUX_GROUP_A:
-                cmd_pec = _generate_CMD_PEC(CMD_CODES_e::READ_GPIO_VOLTAGE_GROUP_A, -1);
-                spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], cmd_pec);
-                break;
-            case ReadGroup_e::AUX_GROUP_B:
-                cmd_pec = _generate_CMD_PEC(CMD_CODES_e::READ_GPIO_VOLTAGE_GROUP_B, -1);
-                spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], cmd_pec);
-                break;
-            default:
-                // NUM_CURRENT_GROUPS is a sentinel value and should never be reached
-                __builtin_unreachable();
+    for (size_t chip = 0; chip < Topology::chips_per_cs; chip++) {
+        if (((chip_mask >> chip) & 1U) == 0) {
+            continue;
         }
+        size_t chip_index = Topology::cs_first_chip[cs] + chip;
 
-        
-        for (size_t chip = 0; chip < num_chips / num_chip_selects; chip++) {
-            size_t chip_index = chip + (cs * (num_chips / num_chip_selects));
-
-            // relevant for cell voltage reading
-            int cells_per_chip = (chip_index % 2 == 0) ? 12 : 9; // Even indexed ICs have 12 cells, odd have 9
-
-            uint8_t start_index;
-            std::array<uint8_t, 6> spi_response;
-
-            //relevant for GPIO reading
-            bool current_group_valid = false;
-            switch(_current_read_group) {
-                case ReadGroup_e::CV_GROUP_A:
-                    current_group_valid = _check_if_valid_packet(spi_data, 8 * chip);
-                    _bms_data.valid_read_packets[chip_index].valid_read_cells_1_to_3 = current_group_valid;
-                    start_index = 0;
-                    break;
-                case ReadGroup_e::CV_GROUP_B:
-                    current_group_valid = _check_if_valid_packet(spi_data, 8 * chip);
-                    _bms_data.valid_read_packets[chip_index].valid_read_cells_4_to_6 = current_group_valid;
-                    start_index = 3;
-                    break;
-                case ReadGroup_e::CV_GROUP_C:
-                    current_group_valid = _check_if_valid_packet(spi_data, 8 * chip);
-                    _bms_data.valid_read_packets[chip_index].valid_read_cells_7_to_9 = current_group_valid;
-                    start_index = 6;
-                    break;
-                case ReadGroup_e::CV_GROUP_D:
-                    current_group_valid = _check_if_valid_packet(spi_data, 8 * chip);
-                    _bms_data.valid_read_packets[chip_index].valid_read_cells_10_to_12 = current_group_valid;
-                    start_index = 9;
-                    break;
-                case ReadGroup_e::AUX_GROUP_A:
-                    current_group_valid = _check_if_valid_packet(spi_data, 8 * chip);
-                    _bms_data.valid_read_packets[chip_index].valid_read_gpios_1_to_3 = current_group_valid;
-                    start_index = 0;
-                    break;
-                case ReadGroup_e::AUX_GROUP_B:
-                    current_group_valid = _check_if_valid_packet(spi_data, 8 * chip);
-                    _bms_data.valid_read_packets[chip_index].valid_read_gpios_4_to_6 = current_group_valid;
-                    start_index = 3;
-                    break;
-                default:
-                    // NUM_CURRENT_GROUPS is a sentinel value and should never be reached
-                    __builtin_unreachable();
-            }
+        std::array<uint8_t, 6> spi_response;
 
-            // Skip processing if current group packet is invalid and skip cells 9-12 for group D cuz they don't exist
-            if (!current_group_valid || (_current_read_group == ReadGroup_e::CV_GROUP_D && cells_per_chip == 9)) {
-                continue;
-            }
+        bool current_group_valid = (valid_packet_mask >> chip) & 1U;
+        _group_validity(chip_index, _current_read_group) = current_group_valid;
 
-            if (_current_read_group == ReadGroup_e::AUX_GROUP_B) {
-                    std::copy_n(spi_data.begin() + (8 * chip), 4, spi_response.begin());
-                    std::fill(spi_response.begin() + 4, spi_response.end(), 0); // padding to make it 6 bytes
-            } else {
-                std::copy_n(spi_data.begin() + (8 * chip), 6, spi_response.begin());
-            }
+        // Skip processing if current group packet is invalid and skip CV groups the chip has no cells in (group D on 9 cell chips)
+        if (!current_group_valid || (_current_read_group <= ReadGroup_e::CV_GROUP_D && !Topology::chip_has_cv_group(chip_index, _current_read_group))) {
+            continue;
+        }
 
-            if (_current_read_group <= ReadGroup_e::CV_GROUP_D) {
-                _load_cell_voltages(_bms_data, _max_min_reference, spi_response, chip_index, start_index);
-            } else {
-                _load_auxillaries(_bms_data, _max_min_reference, spi_response, chip_index, start_index);
-            }
+        if (_current_read_group == ReadGroup_e::AUX_GROUP_B) {
+                std::copy_n(spi_data.begin() + (8 * chip), 4, spi_response.begin());
+                std::fill(spi_response.begin() + 4, spi_response.end(), 0); // padding to make it 6 bytes
+        } else {
+            std::copy_n(spi_data.begin() + (8 * chip), 6, spi_response.begin());
         }
+
+        if (_current_read_group <= ReadGroup_e::CV_GROUP_D) {
+            _load_cell_voltages(_bms_data, _max_min_reference, spi_response, chip_index, start_index);
+        } else {
+            _load_auxillaries(_bms_data, spi_response, chip_index, start_index);
+        }
+    }
+    return valid_packet_mask;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_invalidate_group_response(size_t cs)
+{
+    for (size_t chip = 0; chip < Topology::chips_per_cs; chip++) {
+        _group_validity(Topology::cs_first_chip[cs] + chip, _current_read_group) = false;
     }
+}
 
-    _bms_data.total_voltage = _max_min_reference.total_voltage;
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_finish_group_read()
+{
+    _bms_data.total_voltage = _max_min_reference.total_voltage_code * bms_driver_defaults::CV_ADC_LSB_VOLTAGE;
     _bms_data.avg_cell_voltage = _bms_data.total_voltage / num_cells;
-    _bms_data.average_cell_temperature = _max_min_reference.total_thermistor_temps / (4 * num_chips);
+    _update_extremes();
+    _groups_read_since_publish |= (1U << _current_read_group);
     
     if(_current_read_group == ReadGroup_e::CV_GROUP_D) {
-        _bms_data.min_cell_voltage = _max_min_reference.min_cell_voltage;
-        _bms_data.max_cell_voltage = _max_min_reference.max_cell_voltage;
-        // Reset max and mins
-        _max_min_reference.min_cell_voltage = ref_max_min_defaults::MIN_CELL_VOLTAGE;
-        _max_min_reference.max_cell_voltage = ref_max_min_defaults::MAX_CELL_VOLTAGE;
+        _bms_data.frame_timestamp_us = _cv_conversion_start_us;
     }
     if(_current_read_group == ReadGroup_e::AUX_GROUP_B) {
-        _bms_data.max_cell_temp = _max_min_reference.max_cell_temp;
-        _bms_data.min_cell_temp = _max_min_reference.min_cell_temp;
-        _bms_data.max_board_temp = _max_min_reference.max_board_temp;
-        // Reset max and mins
-        _max_min_reference.min_cell_temp = ref_max_min_defaults::MIN_CELL_TEMP;
-        _max_min_reference.max_cell_temp = ref_max_min_defaults::MAX_CELL_TEMP;
-        _max_min_reference.max_board_temp = ref_max_min_defaults::MAX_BOARD_TEMP;
+        _update_average_cell_temperature();
+    }
+
+    if (_acquisition_mode == AcquisitionMode_e::WEIGHTED)
+    {
+        _groups_read_since_conversion |= (1U << _current_read_group);
+        _update_hot_groups();
+        _current_read_group = _group_scheduler.next();
+        return;
+    }
+
+    if (_current_read_group == ReadGroup_e::CV_GROUP_D && _acquisition_mode == AcquisitionMode_e::ROUND_ROBIN)
+    {
+        _cv_sweeps_in_cycle++;
+        if (_cv_sweeps_in_cycle < std::max<uint8_t>(_config.cv_sweeps_per_aux_sweep, 1))
+        {
+            _current_read_group = ReadGroup_e::CV_GROUP_A; // Another voltage sweep before the temperatures
+            return;
+        }
+        _cv_sweeps_in_cycle = 0;
     }
 
     _current_read_group = advance_read_group(_current_read_group);
-    return _bms_data;
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-typename BMSDriverGroup<num_chips, num_chip_selects, chip_type>::BMSDriverData
-BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_read_data_through_address()
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_update_hot_groups()
+{
+    uint8_t hot_groups = 0;
+    if (!_cell_voltage_extremes.empty())
+    {
+        hot_groups |= (1U << Topology::cell_cv_group[_cell_voltage_extremes.min_index()]);
+        hot_groups |= (1U << Topology::cell_cv_group[_cell_voltage_extremes.max_index()]);
+    }
+    if (!_thermistor_extremes.empty())
+    {
+        // The highest thermistor code is the hottest cell, like max_cell_temp
+        hot_groups |= (1U << (ReadGroup_e::AUX_GROUP_A + Topology::thermistor_aux_group[_thermistor_extremes.max_index()]));
+    }
+    _group_scheduler.set_hot_groups(hot_groups);
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_read_data_through_address()
 {
     ReferenceMaxMin_s max_min_reference;
     ValidPacketData_s clean_valid_packet_data;                  // should be all reset to true
@@ -351,22 +1144,14 @@ BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_read_data_through_addre
         // DEBUG: Check to see that the PEC is what we expect it to be
 
         _bms_data = _load_cell_voltages(_bms_data, max_min_reference, data_in_cell_voltages_1_to_12, chip, battery_cell_count);
-        _bms_data = _load_auxillaries(_bms_data, max_min_reference, data_in_auxillaries_1_to_5, chip, gpio_count);
+        _bms_data = _load_auxillaries(_bms_data, data_in_auxillaries_1_to_5, chip, gpio_count);
     }
 
-    _bms_data.min_cell_voltage = _max_min_reference.min_cell_voltage;
-    _bms_data.max_cell_voltage = _max_min_reference.max_cell_voltage;
-    _bms_data.total_voltage = _max_min_reference.total_voltage;
+    _bms_data.total_voltage = _max_min_reference.total_voltage_code * bms_driver_defaults::CV_ADC_LSB_VOLTAGE;
     _bms_data.avg_cell_voltage = _bms_data.total_voltage / num_cells;
 
-    // Avoid divide by zero - skip calculation if no GPIOs were read
-    if (gpio_count > 0) {
-        _bms_data.average_cell_temperature = max_min_reference.total_thermistor_temps / gpio_count;
-    }
-    _bms_data.max_cell_temp = _bms_data.cell_temperatures[_bms_data.max_cell_temperature_cell_id];
-    _bms_data.max_board_temp = _bms_data.board_temperatures[_bms_data.max_board_temperature_segment_id];
-    
-    return _bms_data;
+    _update_extremes();
+    _update_average_cell_temperature();
 }
 
 
@@ -376,7 +1161,7 @@ void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_load_cell_voltages
 {
     std::array<uint8_t, 2> data_in_cell_voltage;
 
-    uint8_t cell_global_offset = (chip_index / 2) * 21 + (chip_index % 2) * 12;
+    uint8_t cell_global_offset = Topology::chip_first_cell[chip_index];
 
     for (int cell_Index = start_cell_index; cell_Index < start_cell_index+3; cell_Index++)
     {
@@ -384,16 +1169,14 @@ void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_load_cell_voltages
 
         uint16_t voltage_in = data_in_cell_voltage[1] << 8 | data_in_cell_voltage[0];
 
-        float voltage_converted = voltage_in * _config.cv_adc_lsb_voltage;
-
         uint8_t cell_voltage_index = cell_global_offset + cell_Index;
         // Calculate the correct global voltage array index
-        _store_voltage_data(bms_data, max_min_ref, voltage_converted, cell_voltage_index);
+        _store_voltage_data(bms_data, max_min_ref, voltage_in, cell_voltage_index);
     }
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_load_auxillaries(BMSDriverData& bms_data, ReferenceMaxMin_s &max_min_ref, const std::array<uint8_t, 6> &data_in_gpio_group,
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_load_auxillaries(BMSDriverData& bms_data, const std::array<uint8_t, 6> &data_in_gpio_group,
                                                                             uint8_t chip_index, uint8_t start_gpio_index)
 {
     for (int gpio_index = start_gpio_index; gpio_index < start_gpio_index + 3 && gpio_index < 5; gpio_index++) // There are only five Auxillary ports
@@ -402,66 +1185,80 @@ void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_load_auxillaries(B
         std::copy_n(data_in_gpio_group.begin() + (gpio_index - start_gpio_index) * 2, 2, data_in_gpio_voltage.begin());
         
         uint16_t gpio_in = data_in_gpio_voltage[1] << 8 | data_in_gpio_voltage[0];
-        _store_temperature_humidity_data(bms_data, max_min_ref, gpio_in, gpio_index, chip_index);
+        _store_temperature_humidity_data(bms_data, gpio_in, gpio_index, chip_index);
     }
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_store_voltage_data(BMSDriverData &bms_data, ReferenceMaxMin_s &max_min_reference, volt voltage_in, uint8_t cell_index)
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_store_voltage_data(BMSDriverData &bms_data, ReferenceMaxMin_s &max_min_reference, uint16_t voltage_code, uint8_t cell_index)
 {
-    max_min_reference.total_voltage -= bms_data.voltages[cell_index];
-    bms_data.voltages[cell_index] = voltage_in;
-    max_min_reference.total_voltage += bms_data.voltages[cell_index];
-
-    if (voltage_in <= max_min_reference.min_cell_voltage)
-    {
-        max_min_reference.min_cell_voltage = voltage_in;
-        bms_data.min_cell_voltage_id = cell_index;
-    }
-    if (voltage_in >= max_min_reference.max_cell_voltage)
-    {
-        max_min_reference.max_cell_voltage = voltage_in;
-        bms_data.max_cell_voltage_id = cell_index;
-    }
+    max_min_reference.total_voltage_code -= bms_data.voltage_codes[cell_index];
+    bms_data.voltage_codes[cell_index] = voltage_code;
+    max_min_reference.total_voltage_code += voltage_code;
+    _cell_voltage_extremes.update(cell_index, voltage_code);
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_store_temperature_humidity_data(BMSDriverData &bms_data, ReferenceMaxMin_s &max_min_reference, const uint16_t &gpio_in, uint8_t gpio_index, uint8_t chip_index)
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_store_temperature_humidity_data(BMSDriverData &bms_data, const uint16_t &gpio_in, uint8_t gpio_index, uint8_t chip_index)
 {
     // there is 8 cell temperatures per chip, and 2 board temperatures per board, so 4+1 per chip
     if (gpio_index < 4) // These are all thermistors [0,1,2,3].
     {
-        // Calculate the cell temperature index: 4 thermistors per chip
-        uint8_t cell_temp_index = chip_index * 4 + gpio_index;
+        uint8_t cell_temp_index = Topology::thermistor_index[chip_index][gpio_index];
 
-        max_min_reference.total_thermistor_temps -= bms_data.cell_temperatures[cell_temp_index];
-        float thermistor_resistance = (2740 / (gpio_in / 50000.0)) - 2740;
-        bms_data.cell_temperatures[cell_temp_index] = 1 / ((1 / 298.15) + (1 / 3984.0) * std::log(thermistor_resistance / 10000.0)) - 272.15; // calculation for thermistor temperature in C
-        max_min_reference.total_thermistor_temps += bms_data.cell_temperatures[cell_temp_index];
+        bms_data.cell_temperature_codes[cell_temp_index] = gpio_in;
 
-        if (bms_data.cell_temperatures[cell_temp_index] > max_min_reference.max_cell_temp)
+        // At and past full scale the Beta equation has no solution, those codes never become an extreme
+        if (gpio_in >= gpio_temperature_lut::THERMISTOR_FULL_SCALE_CODE)
         {
-            max_min_reference.max_cell_temp = bms_data.cell_temperatures[cell_temp_index];
-            bms_data.max_cell_temperature_cell_id = cell_temp_index;
+            _thermistor_extremes.remove(cell_temp_index);
         }
-        if (bms_data.cell_temperatures[cell_temp_index] < max_min_reference.min_cell_temp)
+        else
         {
-            max_min_reference.min_cell_temp = bms_data.cell_temperatures[cell_temp_index];
-            bms_data.min_cell_temperature_cell_id = cell_temp_index;
+            _thermistor_extremes.update(cell_temp_index, gpio_in);
         }
     }
     else // this is the case for temperature sensor for the BOARD, not the cells. There is 1 per chip
     {
-        constexpr float mcp_9701_temperature_coefficient = 0.0195f;
-        constexpr float mcp_9701_output_v_at_0c = 0.4f;
-        bms_data.board_temperatures[chip_index] = ((gpio_in / 10000.0f) - mcp_9701_output_v_at_0c) / mcp_9701_temperature_coefficient; // 2 per board = 1 per chip, calculation for bord temps
-        if (bms_data.board_temperatures[chip_index] > max_min_reference.max_board_temp)
-        {
-            max_min_reference.max_board_temp = bms_data.board_temperatures[chip_index];
+        bms_data.board_temperature_codes[chip_index] = gpio_in; // 2 per board = 1 per chip, MCP9701 board temps
+        _board_temp_extremes.update(chip_index, gpio_in);
+    }
+}
 
-            bms_data.max_board_temperature_segment_id = chip_index; // Because each chip has 1 board temp sensor
-        }
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_update_extremes()
+{
+    // Nothing read yet keeps the previous values
+    if (!_cell_voltage_extremes.empty())
+    {
+        _bms_data.min_cell_voltage = _cell_voltage_extremes.min_value() * bms_driver_defaults::CV_ADC_LSB_VOLTAGE;
+        _bms_data.max_cell_voltage = _cell_voltage_extremes.max_value() * bms_driver_defaults::CV_ADC_LSB_VOLTAGE;
+        _bms_data.min_cell_voltage_id = _cell_voltage_extremes.min_index();
+        _bms_data.max_cell_voltage_id = _cell_voltage_extremes.max_index();
+    }
+    if (!_thermistor_extremes.empty())
+    {
+        _bms_data.max_cell_temp = gpio_temperature_lut::thermistor_code_to_celsius(_thermistor_extremes.max_value());
+        _bms_data.min_cell_temp = gpio_temperature_lut::thermistor_code_to_celsius(_thermistor_extremes.min_value());
+        _bms_data.max_cell_temperature_cell_id = _thermistor_extremes.max_index();
+        _bms_data.min_cell_temperature_cell_id = _thermistor_extremes.min_index();
+    }
+    if (!_board_temp_extremes.empty())
+    {
+        _bms_data.max_board_temp = gpio_temperature_lut::mcp9701_code_to_celsius(_board_temp_extremes.max_value());
+        _bms_data.max_board_temperature_segment_id = _board_temp_extremes.max_index(); // Because each chip has 1 board temp sensor
+    }
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_update_average_cell_temperature()
+{
+    celsius total_thermistor_temps = 0;
+    for (size_t thermistor = 0; thermistor < num_cell_temps; thermistor++)
+    {
+        total_thermistor_temps += _bms_data.cell_temperature(thermistor);
     }
+    _bms_data.average_cell_temperature = total_thermistor_temps / num_cell_temps;
 }
 
 /* -------------------- WRITING DATA FUNCTIONS -------------------- */
@@ -470,18 +1267,16 @@ template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
 void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::write_configuration(const std::array<bool, num_cells> &cell_balance_statuses)
 {
     std::array<uint16_t, num_chips> cb;
-    size_t global_cell_index = 0;
     for (size_t chip = 0; chip < num_chips; chip++)
     {
         uint16_t chip_cb = 0;
-        size_t cells_per_chip = (chip % 2 == 0) ? 12 : 9;
-        for (size_t cell_i = 0; cell_i < cells_per_chip; cell_i++)
+        const size_t first_cell = Topology::chip_first_cell[chip];
+        for (size_t cell_i = 0; cell_i < Topology::chip_num_cells[chip]; cell_i++)
         {
-            if (cell_balance_statuses[global_cell_index])
+            if (cell_balance_statuses[first_cell + cell_i])
             {
                 chip_cb = (0b1 << cell_i) | chip_cb;
             }
-            global_cell_index++;
         }
         cb[chip] = chip_cb;
     }
@@ -492,52 +1287,178 @@ void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::write_configuration
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
 void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::write_configuration(uint8_t dcto_mode, const std::array<uint16_t, num_chips> &cell_balance_statuses)
 {
+    _wait_for_async_transfer();
     std::copy(cell_balance_statuses.begin(), cell_balance_statuses.end(), _cell_discharge_en.begin());
+    _dcto_mode = dcto_mode;
+    _update_requested_config();
+
+    if constexpr (chip_type == LTC6811_Type_e::LTC6811_1)
+    {
+        for (size_t cs = 0; cs < num_chip_selects; cs++)
+        {
+            _write_config_if_needed(cs);
+        }
+    }
+    else
+    {
+        std::array<uint8_t, 6> buffer_format = _build_config_register_prefix();
+        _start_wakeup_protocol();
+        _write_config_through_address(dcto_mode, buffer_format, cell_balance_statuses);
+    }
+}
 
-    std::array<uint8_t, 6> buffer_format; // This buffer processing can be seen in more detail on page 62 of the data sheet
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+std::array<uint8_t, 6> BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_build_config_register_prefix()
+{
+    std::array<uint8_t, 6> buffer_format = {}; // This buffer processing can be seen in more detail on page 62 of the data sheet
     buffer_format[0] = (_config.gpios_enabled << 3) | (static_cast<int>(_config.device_refup_mode) << 2) | static_cast<int>(_config.adcopt);
     buffer_format[1] = (_config.under_voltage_threshold & 0x0FF);
     buffer_format[2] = ((_config.over_voltage_threshold & 0x00F) << 4) | ((_config.under_voltage_threshold & 0xF00) >> 8);
     buffer_format[3] = ((_config.over_voltage_threshold & 0xFF0) >> 4);
+    return buffer_format;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_update_requested_config()
+{
+    const std::array<uint8_t, 6> buffer_format = _build_config_register_prefix();
+    for (size_t chip = 0; chip < num_chips; chip++)
+    {
+        _config_requested[chip] = buffer_format;
+        _config_requested[chip][4] = ((_cell_discharge_en[chip] & 0x0FF));
+        _config_requested[chip][5] = ((_dcto_mode & 0x0F) << 4) | ((_cell_discharge_en[chip] & 0xF00) >> 8);
+    }
+}
 
-    _start_wakeup_protocol();
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+std::array<uint8_t, 8 * (num_chips / num_chip_selects)>
+BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_build_config_payload(size_t cs)
+{
+    std::array<uint8_t, 8 * Topology::chips_per_cs> full_buffer;
+    std::array<uint8_t, 2> temp_pec;
 
-    if constexpr (chip_type == LTC6811_Type_e::LTC6811_1)
+    // This needs to be flipped because when writing a command, primary device holds the last bytes
+    for (size_t j = 0; j < Topology::chips_per_cs; j++)
     {
-        _write_config_through_broadcast(dcto_mode, buffer_format, cell_balance_statuses);
+        const size_t i = Topology::cs_first_chip[cs] + (Topology::chips_per_cs - 1 - j);
+        temp_pec = _calculate_specific_PEC(_config_requested[i].data(), 6);
+        std::copy_n(_config_requested[i].begin(), 6, full_buffer.data() + (j * 8));
+        std::copy_n(temp_pec.begin(), 2, full_buffer.data() + 6 + (j * 8));
     }
-    else
+    return full_buffer;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_config_shadow_current(size_t cs, uint32_t at_us)
+{
+    // A core that went to SLEEP has reset its CFGR, so the shadow no longer says anything about the chips
+    if (!_config_shadow_valid[cs] || !_bus_activity_seen[cs] || (at_us - _last_bus_activity_us[cs]) >= _config.core_sleep_timeout_us)
     {
-        _write_config_through_address(dcto_mode, buffer_format, cell_balance_statuses);
+        return false;
+    }
+    for (size_t chip = 0; chip < Topology::chips_per_cs; chip++)
+    {
+        const size_t chip_index = Topology::cs_first_chip[cs] + chip;
+        if (_config_shadow[chip_index] != _config_requested[chip_index])
+        {
+            return false;
+        }
     }
+    return true;
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_write_config_through_broadcast(uint8_t dcto_mode, std::array<uint8_t, 6> buffer_format, const std::array<uint16_t, num_chips> &cell_balance_statuses)
+bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_config_write_needed(size_t cs, uint32_t at_us)
 {
-    constexpr size_t data_size = 8 * (num_chips / num_chip_selects);
-    std::array<uint8_t, 4> cmd_and_pec = _generate_CMD_PEC(CMD_CODES_e::WRITE_CONFIG, -1);
-    std::array<uint8_t, data_size> full_buffer;
-    std::array<uint8_t, 2> temp_pec;
+    if (!_config_shadow_current(cs, at_us))
+    {
+        return true;
+    }
+    return _config.config_refresh_period_us != 0 && (at_us - _last_config_write_us[cs]) >= _config.config_refresh_period_us;
+}
 
-    // Needs to be sent on each chip select line
-    for (size_t cs = 0; cs < num_chip_selects; cs++)
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_commit_config_shadow(size_t cs, uint32_t at_us)
+{
+    for (size_t chip = 0; chip < Topology::chips_per_cs; chip++)
     {
-        size_t j = 0;
-        for (int i = num_chips - 1; i >= 0; i--)              // This needs to be flipped because when writing a command, primary device holds the last bytes
-        {                                                     // Find chips with the same CS
-            if (_chip_select_per_chip[i] == _chip_select[cs]) // This could be an optimization:  && j < (num_chips + 1) / 2)
-            {
-                buffer_format[4] = ((cell_balance_statuses[i] & 0x0FF));
-                buffer_format[5] = ((dcto_mode & 0x0F) << 4) | ((cell_balance_statuses[i] & 0xF00) >> 8);
-                temp_pec = _calculate_specific_PEC(buffer_format.data(), 6);
-                std::copy_n(buffer_format.begin(), 6, full_buffer.data() + (j * 8));
-                std::copy_n(temp_pec.begin(), 2, full_buffer.data() + 6 + (j * 8));
-                j++;
-            }
+        const size_t chip_index = Topology::cs_first_chip[cs] + chip;
+        _config_shadow[chip_index] = _config_requested[chip_index];
+    }
+    _config_shadow_valid[cs] = true;
+    _last_config_write_us[cs] = at_us;
+    _config_write_stats.config_writes_sent++;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_write_config_if_needed(size_t cs)
+{
+    const uint32_t now_us = micros();
+    if (!_config_write_needed(cs, now_us))
+    {
+        _config_write_stats.config_writes_skipped++;
+        return;
+    }
+
+    // Only the refresh is due: if the chips still hold CFGR, reading it is all the refresh needs to do
+    if (_config.verify_config_before_refresh && _config_shadow_current(cs, now_us) && _verify_config(cs))
+    {
+        _last_config_write_us[cs] = now_us;
+        _config_write_stats.refresh_writes_avoided++;
+        return;
+    }
+
+    _write_config(cs);
+    if (_config.config_verify_interval_writes == 0)
+    {
+        return;
+    }
+    _config_writes_since_verify[cs]++;
+    if (_config_writes_since_verify[cs] >= _config.config_verify_interval_writes)
+    {
+        _config_writes_since_verify[cs] = 0;
+        if (!_verify_config(cs))
+        {
+            _write_config(cs); // Only this chip select, the next verification shows whether it took this time
+        }
+    }
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_write_config(size_t cs)
+{
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+    _start_wakeup_protocol(cs);
+    ltc_spi_interface::write_registers_command<data_size>(_chip_select[cs], _command_frames.write_config, _build_config_payload(cs));
+    _mark_bus_activity(cs);
+    _commit_config_shadow(cs, micros());
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_verify_config(size_t cs)
+{
+    constexpr size_t data_size = 8 * Topology::chips_per_cs;
+    _start_wakeup_protocol(cs);
+    std::array<uint8_t, data_size> spi_data = ltc_spi_interface::read_registers_command<data_size>(_chip_select[cs], _command_frames.read_config);
+    _mark_bus_activity(cs);
+
+    const uint32_t valid_packet_mask = _get_valid_packet_mask(spi_data);
+    bool config_matches = true;
+    for (size_t chip = 0; chip < Topology::chips_per_cs; chip++)
+    {
+        const size_t chip_index = Topology::cs_first_chip[cs] + chip;
+        if (((valid_packet_mask >> chip) & 1U) == 0 || !ltc_command_frames::config_readback_matches(spi_data.data() + (8 * chip), _config_requested[chip_index]))
+        {
+            config_matches = false;
         }
-        ltc_spi_interface::write_registers_command<data_size>(_chip_select[cs], cmd_and_pec, full_buffer);
     }
+
+    _config_write_stats.config_verifications++;
+    if (!config_matches)
+    {
+        _config_write_stats.config_verification_failures++;
+    }
+    return config_matches;
 }
 
 /* UNUSED: LTC6811-2 ADDRESS MODE - REFERENCE ONLY
@@ -564,53 +1485,181 @@ void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_write_config_throu
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
 void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_start_cell_voltage_ADC_conversion()
 {
-    uint16_t adc_cmd = (uint16_t)CMD_CODES_e::START_CV_ADC_CONVERSION | (_config.adc_mode_cv_conversion << 7) | (_config.discharge_permitted << 4) | static_cast<uint8_t>(_config.adc_conversion_cell_select_mode);
-    std::array<uint8_t, 2> cmd;
-    cmd[0] = (adc_cmd >> 8) & 0xFF;
-    cmd[1] = adc_cmd & 0xFF;
     if constexpr (chip_type == LTC6811_Type_e::LTC6811_1)
     {
-        _start_ADC_conversion_through_broadcast(cmd);
+        _start_ADC_conversion_through_broadcast(_command_frames.start_cv_adc[_adc_mode_cv]);
     }
     else
     {
-        _start_ADC_conversion_through_address(cmd);
+        uint16_t adc_cmd = ltc_command_frames::make_adc_cmd_code(CMD_CODES_e::START_CV_ADC_CONVERSION, _adc_mode_cv, _config.discharge_permitted, _config.adc_conversion_cell_select_mode);
+        _start_ADC_conversion_through_address({static_cast<uint8_t>(adc_cmd >> 8), static_cast<uint8_t>(adc_cmd)});
     }
+    _conversion_time_ms = _cv_conversion_time_ms();
+    _cv_conversion_start_us = _conversion_start_us;
+    _record_conversion_start(ReadGroup_e::CV_GROUP_A, ReadGroup_e::CV_GROUP_D);
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
 void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_start_GPIO_ADC_conversion()
 {
-    uint16_t adc_cmd = (uint16_t)CMD_CODES_e::START_GPIO_ADC_CONVERSION | (_config.adc_mode_gpio_conversion << 7); // | static_cast<uint8_t>(_config.adc_conversion_gpio_select_mode);
-    std::array<uint8_t, 2> cmd;
-    cmd[0] = (adc_cmd >> 8) & 0xFF;
-    cmd[1] = adc_cmd & 0xFF;
+    if constexpr (chip_type == LTC6811_Type_e::LTC6811_1)
+    {
+        _start_ADC_conversion_through_broadcast(_command_frames.start_gpio_adc[_adc_mode_gpio]);
+    }
+    else
+    {
+        uint16_t adc_cmd = ltc_command_frames::make_adc_cmd_code(CMD_CODES_e::START_GPIO_ADC_CONVERSION, _adc_mode_gpio, 0, 0); // | static_cast<uint8_t>(_config.adc_conversion_gpio_select_mode);
+        _start_ADC_conversion_through_address({static_cast<uint8_t>(adc_cmd >> 8), static_cast<uint8_t>(adc_cmd)});
+    }
+    _conversion_time_ms = _gpio_conversion_time_ms();
+    _record_conversion_start(ReadGroup_e::AUX_GROUP_A, ReadGroup_e::AUX_GROUP_B);
+}
 
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_start_cell_and_GPIO_ADC_conversion()
+{
     if constexpr (chip_type == LTC6811_Type_e::LTC6811_1)
     {
-        _start_ADC_conversion_through_broadcast(cmd);
+        _start_ADC_conversion_through_broadcast(_command_frames.start_cv_gpio_adc[_adc_mode_cv]);
     }
     else
     {
-        _start_ADC_conversion_through_address(cmd);
+        uint16_t adc_cmd = ltc_command_frames::make_adc_cmd_code(CMD_CODES_e::START_CV_GPIO_ADC_CONVERSION, _adc_mode_cv, _config.discharge_permitted, 0);
+        _start_ADC_conversion_through_address({static_cast<uint8_t>(adc_cmd >> 8), static_cast<uint8_t>(adc_cmd)});
     }
+    _conversion_time_ms = std::max(_cv_conversion_time_ms(), _gpio_conversion_time_ms());
+    _cv_conversion_start_us = _conversion_start_us;
+    // ADCVAX only converts GPIO1-2, the aux groups also hold GPIO3-5 and keep the time of their last ADAX
+    _record_conversion_start(ReadGroup_e::CV_GROUP_A, ReadGroup_e::CV_GROUP_D);
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_start_ADC_conversion_through_broadcast(const std::array<uint8_t, 2> &cmd_code)
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_apply_requested_adc_modes()
 {
-    // Leave the command code as is
-    std::array<uint8_t, 2> cc = {cmd_code[0], cmd_code[1]};
-    std::array<uint8_t, 2> pec = _calculate_specific_PEC(cc.data(), 2);
-    std::array<uint8_t, 4> cmd_and_pec;
-    std::copy_n(cmd_code.begin(), 2, cmd_and_pec.begin()); // Copy first two bytes (cmd)
-    std::copy_n(pec.begin(), 2, cmd_and_pec.begin() + 2);  // Copy next two bytes (pec)
+    _adc_mode_cv = _requested_adc_mode_cv;
+    _adc_mode_gpio = _requested_adc_mode_gpio;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+float BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_cv_conversion_time_ms()
+{
+    return (_adc_mode_cv == _config.adc_mode_cv_conversion) ? _config.cv_adc_conversion_time_ms : bms_driver_defaults::ADC_CONVERSION_TIME_MS_BY_MODE[_adc_mode_cv];
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+float BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_gpio_conversion_time_ms()
+{
+    return (_adc_mode_gpio == _config.adc_mode_gpio_conversion) ? _config.gpio_adc_conversion_time_ms : bms_driver_defaults::ADC_CONVERSION_TIME_MS_BY_MODE[_adc_mode_gpio];
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+float BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_status_conversion_time_ms(uint8_t md) const
+{
+    return (md == _config.adc_mode_cv_conversion) ? _config.status_adc_conversion_time_ms : bms_driver_defaults::STATUS_ADC_CONVERSION_TIME_MS_BY_MODE[md & 0x3];
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_record_conversion_start(ReadGroup_e first_group, ReadGroup_e last_group)
+{
+    for (int group = first_group; group <= last_group; group++)
+    {
+        _group_conversion_start_us[group] = _cs_conversion_start_us;
+    }
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_record_group_capture(size_t cs)
+{
+    const uint32_t now_us = micros();
+    GroupCaptureTime_s &capture = _bms_data.group_capture_times[_current_read_group][cs];
+    capture.conversion_start_us = _group_conversion_start_us[_current_read_group][cs];
+    capture.read_us = now_us;
+
+    // Registers read before the first conversion hold power-on values, not a sample
+    if (capture.conversion_start_us == 0)
+    {
+        return;
+    }
+    const uint32_t latency_us = now_us - capture.conversion_start_us;
+    _acquisition_latency_stats.last_latency_us = latency_us;
+    _latency_window_sum_us += latency_us;
+    _latency_window_min_us = std::min(_latency_window_min_us, latency_us);
+    _latency_window_max_us = std::max(_latency_window_max_us, latency_us);
+    _latency_window_samples++;
+
+    if (_latency_window_samples >= std::max<uint16_t>(_config.acquisition_latency_window, 1))
+    {
+        _acquisition_latency_stats.window_min_latency_us = _latency_window_min_us;
+        _acquisition_latency_stats.window_avg_latency_us = static_cast<uint32_t>(_latency_window_sum_us / _latency_window_samples);
+        _acquisition_latency_stats.window_max_latency_us = _latency_window_max_us;
+        _acquisition_latency_stats.windows_completed++;
+        _latency_window_sum_us = 0;
+        _latency_window_min_us = UINT32_MAX;
+        _latency_window_max_us = 0;
+        _latency_window_samples = 0;
+    }
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+uint32_t BMSDriverGroup<num_chips, num_chip_selects, chip_type>::get_cell_voltage_age_us(size_t cell, uint32_t now_us) const
+{
+    const size_t cs = Topology::chip_cs[Topology::cell_chip[cell]];
+    return now_us - get_bms_data().group_capture_times[Topology::cell_cv_group[cell]][cs].conversion_start_us;
+}
 
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+uint32_t BMSDriverGroup<num_chips, num_chip_selects, chip_type>::get_cell_temperature_age_us(size_t thermistor, uint32_t now_us) const
+{
+    const size_t group = ReadGroup_e::AUX_GROUP_A + Topology::thermistor_aux_group[thermistor];
+    return now_us - get_bms_data().group_capture_times[group][Topology::chip_cs[Topology::thermistor_chip[thermistor]]].conversion_start_us;
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_start_ADC_conversion_through_broadcast(const std::array<uint8_t, 4> &cmd_and_pec)
+{
+    _wait_for_async_transfer();
     // Needs to be sent on each chip select line
     for (size_t cs = 0; cs < num_chip_selects; cs++) {
         _start_wakeup_protocol(cs);
-        ltc_spi_interface::adc_conversion_command(_chip_select[cs], cmd_and_pec, (num_chips / num_chip_selects));
+        ltc_spi_interface::adc_conversion_command(_chip_select[cs], cmd_and_pec, Topology::chips_per_cs);
+        _mark_bus_activity(cs);
+        _cs_conversion_start_us[cs] = micros();
+    }
+    _conversion_pending = true;
+    _conversion_start_us = micros();
+}
+
+template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
+bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_conversion_ready_for_read()
+{
+    if (!_conversion_pending)
+    {
+        return true;
+    }
+    if (!_config.poll_adc_status)
+    {
+        // A read period shorter than the conversion (a slow ADC mode) would otherwise read half converted registers
+        return (micros() - _conversion_start_us) >= static_cast<uint32_t>(_conversion_time_ms * 1000.0f);
+    }
+
+    _wait_for_async_transfer();
+    for (size_t cs = 0; cs < num_chip_selects; cs++) {
+        _start_wakeup_protocol(cs);
+        bool conversion_done = ltc_spi_interface::poll_adc_status_command(_chip_select[cs], _command_frames.poll_adc_status);
+        _mark_bus_activity(cs);
+        if (!conversion_done) {
+            _conversion_latency_stats.polls_not_ready++;
+            return false;
+        }
     }
+
+    uint32_t latency_us = micros() - _conversion_start_us;
+    _conversion_pending = false;
+    _conversion_latency_stats.last_latency_us = latency_us;
+    _conversion_latency_stats.min_latency_us = std::min(_conversion_latency_stats.min_latency_us, latency_us);
+    _conversion_latency_stats.max_latency_us = std::max(_conversion_latency_stats.max_latency_us, latency_us);
+    _conversion_latency_stats.conversions_completed++;
+    return true;
 }
 
 /* UNUSED: LTC6811-2 ADDRESS MODE - REFERENCE ONLY
@@ -636,19 +1685,7 @@ void BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_start_ADC_conversi
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
 std::array<uint8_t, 2> BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_calculate_specific_PEC(const uint8_t *data, int length)
 {
-    std::array<uint8_t, 2> pec;
-    uint16_t remainder;
-    uint16_t addr;
-    remainder = 0x10; // PEC seed
-    for (int i = 0; i < length; i++)
-    {
-        addr = ((remainder >> 7) ^ data[i]) & 0xff; // calculate PEC table address
-        remainder = (remainder << 8) ^ (uint16_t)_pec15Table[addr];
-    }
-    remainder = remainder * 2; // The CRC15 has a 0 in the LSB so the final value must be multiplied by 2
-    pec[0] = (uint8_t)((remainder >> 8) & 0xFF);
-    pec[1] = (uint8_t)(remainder & 0xFF);
-    return pec;
+    return ltc_command_frames::calculate_pec(_pec15Table, data, length);
 }
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
@@ -684,15 +1721,9 @@ std::array<uint8_t, 4> BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_
 
 
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
-bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_check_if_valid_packet(const std::array<uint8_t, 8 * (num_chips / num_chip_selects)> &data, size_t param_iterator)
+uint32_t BMSDriverGroup<num_chips, num_chip_selects, chip_type>::_get_valid_packet_mask(const std::array<uint8_t, 8 * (num_chips / num_chip_selects)> &data)
 {
-    std::array<uint8_t, 6> sample_packet;
-    std::array<uint8_t, 2> sample_pec;
-    std::copy_n(data.begin() + param_iterator, 6, sample_packet.begin());
-    std::copy_n(data.begin() + param_iterator + 6, 2, sample_pec.begin());
-    std::array<uint8_t, 2> calculated_pec = _calculate_specific_PEC(sample_packet.data(), 6);
-
-    return calculated_pec[0] == sample_pec[0] && calculated_pec[1] == sample_pec[1];
+    return ltc_command_frames::validate_group_response_pecs<Topology::chips_per_cs>(_pec15_slice_table, data);
 }
 
 /* -------------------- OBSERVABILITY FUNCTIONS -------------------- */
@@ -721,9 +1752,10 @@ const char* BMSDriverGroup<num_chips, num_chip_selects, chip_type>::get_current_
 template <size_t num_chips, size_t num_chip_selects, LTC6811_Type_e chip_type>
 bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::last_read_all_valid()
 {
-    // Check validity for the specific group that was just read (current state before advancing)
+    // Check validity for the specific group that was just read (current state before advancing), as published
+    const auto& valid_read_packets = get_bms_data().valid_read_packets;
     for (size_t chip = 0; chip < num_chips; chip++) {
-        const auto& validity = _bms_data.valid_read_packets[chip];
+        const auto& validity = valid_read_packets[chip];
 
         switch (_current_read_group) {
             case ReadGroup_e::CV_GROUP_A:
@@ -736,8 +1768,8 @@ bool BMSDriverGroup<num_chips, num_chip_selects, chip_type>::last_read_all_valid
                 if (!validity.valid_read_cells_7_to_9) return false;
                 break;
             case ReadGroup_e::CV_GROUP_D:
-                // Skip 9-cell chips (odd indices)
-                if (chip % 2 == 0 && !validity.valid_read_cells_10_to_12) return false;
+                // Skip chips without cells 10-12
+                if (Topology::chip_has_cv_group(chip, ReadGroup_e::CV_GROUP_D) && !validity.valid_read_cells_10_to_12) return false;
                 break;
             case ReadGroup_e::AUX_GROUP_A:
                 if (!validity.valid_read_gpios_1_to_3) return false;
@@ -757,9 +1789,10 @@ size_t BMSDriverGroup<num_chips, num_chip_selects, chip_type>::count_invalid_pac
 {
     size_t invalid_count = 0;
 
-    // Count invalidity for the specific group that was just read
+    // Count invalidity for the specific group that was just read, as published
+    const auto& valid_read_packets = get_bms_data().valid_read_packets;
     for (size_t chip = 0; chip < num_chips; chip++) {
-        const auto& validity = _bms_data.valid_read_packets[chip];
+        const auto& validity = valid_read_packets[chip];
 
         switch (_current_read_group) {
             case ReadGroup_e::CV_GROUP_A:
@@ -772,8 +1805,8 @@ size_t BMSDriverGroup<num_chips, num_chip_selects, chip_type>::count_invalid_pac
                 if (!validity.valid_read_cells_7_to_9) invalid_count++;
                 break;
             case ReadGroup_e::CV_GROUP_D:
-                // Skip 9-cell chips (odd indices) when counting
-                if (chip % 2 == 0 && !validity.valid_read_cells_10_to_12) invalid_count++;
+                // Skip chips without cells 10-12 when counting
+                if (Topology::chip_has_cv_group(chip, ReadGroup_e::CV_GROUP_D) && !validity.valid_read_cells_10_to_12) invalid_count++;
                 break;
             case ReadGroup_e::AUX_GROUP_A:
                 if (!validity.valid_read_gpios_1_to_3) invalid_count++;
@@ -0,0 +1,218 @@
+#ifndef BMS_PACK_TOPOLOGY_H
+#define BMS_PACK_TOPOLOGY_H
+
+#include <array>
+#include <cstdint>
+#include <stddef.h>
+
+/**
+ * The accumulator layout. Segments are a pair of LTC6811s, the first chip of a pair monitors 12 cells and the
+ * second 9 (21 cells per segment). Chips are split evenly and in order over the chip selects.
+ * Changing the pack layout means changing these, everything else indexes through BMSPackTopology.
+ */
+namespace bms_pack_layout
+{
+    constexpr const size_t NUM_CHIPS = 12;
+    constexpr const size_t NUM_CHIP_SELECTS = 2;
+    constexpr const size_t CELLS_ON_EVEN_CHIP = 12;
+    constexpr const size_t CELLS_ON_ODD_CHIP = 9;
+
+    constexpr const size_t THERMISTORS_PER_CHIP = 4; // GPIO1-4, GPIO5 is the board temperature sensor
+    constexpr const size_t CELLS_PER_CV_GROUP = 3;
+    constexpr const size_t NUM_CV_GROUPS = 4;         // CV groups A-D
+    constexpr const uint8_t NO_CELL = 0xFF;           // cell slot of a CV group the chip has no cell in
+}
+
+/**
+ * Lookup tables for where every cell and thermistor of the pack lives, generated at compile time so the
+ * read / decode / balancing paths never do chip or cell index arithmetic at runtime.
+ *
+ * @tparam num_chips chips in the daisy chain(s)
+ * @tparam num_chip_selects chip selects the chips are split over, in order
+ * @tparam cells_on_even_chip cells on chips 0, 2, 4, ...
+ * @tparam cells_on_odd_chip cells on chips 1, 3, 5, ...
+ */
+template <size_t num_chips,
+          size_t num_chip_selects = 1,
+          size_t cells_on_even_chip = bms_pack_layout::CELLS_ON_EVEN_CHIP,
+          size_t cells_on_odd_chip = bms_pack_layout::CELLS_ON_ODD_CHIP>
+struct BMSPackTopology
+{
+    static_assert(num_chip_selects > 0 && num_chips % num_chip_selects == 0, "Chips must split evenly over the chip selects");
+    static_assert(cells_on_even_chip <= bms_pack_layout::CELLS_PER_CV_GROUP * bms_pack_layout::NUM_CV_GROUPS &&
+                      cells_on_odd_chip <= bms_pack_layout::CELLS_PER_CV_GROUP * bms_pack_layout::NUM_CV_GROUPS,
+                  "An LTC6811 monitors at most 12 cells");
+
+    static constexpr size_t chips_per_cs = num_chips / num_chip_selects;
+    static constexpr size_t num_cells = (((num_chips + 1) / 2) * cells_on_even_chip) + ((num_chips / 2) * cells_on_odd_chip);
+    static constexpr size_t num_cell_temps = num_chips * bms_pack_layout::THERMISTORS_PER_CHIP;
+    static constexpr size_t num_board_temps = num_chips;
+
+    static_assert(num_cells < bms_pack_layout::NO_CELL && num_cell_temps <= UINT8_MAX, "Indexes are stored as uint8_t");
+
+    using ChipTable = std::array<uint8_t, num_chips>;
+    using CVGroupCells = std::array<uint8_t, bms_pack_layout::CELLS_PER_CV_GROUP>;
+
+    /**
+     * Cells monitored by each chip
+     */
+    static constexpr ChipTable chip_num_cells = [] {
+        ChipTable table{};
+        for (size_t chip = 0; chip < num_chips; chip++)
+        {
+            table[chip] = static_cast<uint8_t>((chip % 2 == 0) ? cells_on_even_chip : cells_on_odd_chip);
+        }
+        return table;
+    }();
+
+    /**
+     * Global index of each chip's first cell, its cells are chip_first_cell ... chip_first_cell + chip_num_cells - 1
+     */
+    static constexpr ChipTable chip_first_cell = [] {
+        ChipTable table{};
+        size_t first_cell = 0;
+        for (size_t chip = 0; chip < num_chips; chip++)
+        {
+            table[chip] = static_cast<uint8_t>(first_cell);
+            first_cell += chip_num_cells[chip];
+        }
+        return table;
+    }();
+
+    /**
+     * Chip select index each chip is on
+     */
+    static constexpr ChipTable chip_cs = [] {
+        ChipTable table{};
+        for (size_t chip = 0; chip < num_chips; chip++)
+        {
+            table[chip] = static_cast<uint8_t>(chip / chips_per_cs);
+        }
+        return table;
+    }();
+
+    /**
+     * Global index of the first chip on each chip select, the chip at position n in a chip select's response
+     * is cs_first_chip[cs] + n
+     */
+    static constexpr std::array<uint8_t, num_chip_selects> cs_first_chip = [] {
+        std::array<uint8_t, num_chip_selects> table{};
+        for (size_t cs = 0; cs < num_chip_selects; cs++)
+        {
+            table[cs] = static_cast<uint8_t>(cs * chips_per_cs);
+        }
+        return table;
+    }();
+
+    /**
+     * Chip monitoring each cell
+     */
+    static constexpr std::array<uint8_t, num_cells> cell_chip = [] {
+        std::array<uint8_t, num_cells> table{};
+        for (size_t chip = 0; chip < num_chips; chip++)
+        {
+            for (size_t cell = 0; cell < chip_num_cells[chip]; cell++)
+            {
+                table[chip_first_cell[chip] + cell] = static_cast<uint8_t>(chip);
+            }
+        }
+        return table;
+    }();
+
+    /**
+     * CV group (0-3 = A-D) each cell is read in
+     */
+    static constexpr std::array<uint8_t, num_cells> cell_cv_group = [] {
+        std::array<uint8_t, num_cells> table{};
+        for (size_t cell = 0; cell < num_cells; cell++)
+        {
+            table[cell] = static_cast<uint8_t>((cell - chip_first_cell[cell_chip[cell]]) / bms_pack_layout::CELLS_PER_CV_GROUP);
+        }
+        return table;
+    }();
+
+    /**
+     * Number of CV groups (A-D) holding at least one of the chip's cells, groups past it are not decoded
+     */
+    static constexpr ChipTable chip_num_cv_groups = [] {
+        ChipTable table{};
+        for (size_t chip = 0; chip < num_chips; chip++)
+        {
+            table[chip] = static_cast<uint8_t>((chip_num_cells[chip] + bms_pack_layout::CELLS_PER_CV_GROUP - 1) / bms_pack_layout::CELLS_PER_CV_GROUP);
+        }
+        return table;
+    }();
+
+    /**
+     * Global cell index of each of the 3 cells in each CV group of each chip, NO_CELL past the chip's last cell
+     */
+    static constexpr std::array<std::array<CVGroupCells, bms_pack_layout::NUM_CV_GROUPS>, num_chips> cv_group_cells = [] {
+        std::array<std::array<CVGroupCells, bms_pack_layout::NUM_CV_GROUPS>, num_chips> table{};
+        for (size_t chip = 0; chip < num_chips; chip++)
+        {
+            for (size_t group = 0; group < bms_pack_layout::NUM_CV_GROUPS; group++)
+            {
+                for (size_t slot = 0; slot < bms_pack_layout::CELLS_PER_CV_GROUP; slot++)
+                {
+                    const size_t cell_on_chip = (group * bms_pack_layout::CELLS_PER_CV_GROUP) + slot;
+                    table[chip][group][slot] = (cell_on_chip < chip_num_cells[chip]) ? static_cast<uint8_t>(chip_first_cell[chip] + cell_on_chip) : bms_pack_layout::NO_CELL;
+                }
+            }
+        }
+        return table;
+    }();
+
+    /**
+     * Index into the cell temperature array of each chip's thermistors (GPIO1-4)
+     */
+    static constexpr std::array<std::array<uint8_t, bms_pack_layout::THERMISTORS_PER_CHIP>, num_chips> thermistor_index = [] {
+        std::array<std::array<uint8_t, bms_pack_layout::THERMISTORS_PER_CHIP>, num_chips> table{};
+        for (size_t chip = 0; chip < num_chips; chip++)
+        {
+            for (size_t gpio = 0; gpio < bms_pack_layout::THERMISTORS_PER_CHIP; gpio++)
+            {
+                table[chip][gpio] = static_cast<uint8_t>((chip * bms_pack_layout::THERMISTORS_PER_CHIP) + gpio);
+            }
+        }
+        return table;
+    }();
+
+    /**
+     * Chip each thermistor is wired to
+     */
+    static constexpr std::array<uint8_t, num_cell_temps> thermistor_chip = [] {
+        std::array<uint8_t, num_cell_temps> table{};
+        for (size_t chip = 0; chip < num_chips; chip++)
+        {
+            for (size_t gpio = 0; gpio < bms_pack_layout::THERMISTORS_PER_CHIP; gpio++)
+            {
+                table[thermistor_index[chip][gpio]] = static_cast<uint8_t>(chip);
+            }
+        }
+        return table;
+    }();
+
+    /**
+     * AUX group (0-1 = A-B) each thermistor is read in, GPIO1-3 are in AUX A and GPIO4 in AUX B
+     */
+    static constexpr std::array<uint8_t, num_cell_temps> thermistor_aux_group = [] {
+        std::array<uint8_t, num_cell_temps> table{};
+        for (size_t thermistor = 0; thermistor < num_cell_temps; thermistor++)
+        {
+            table[thermistor] = static_cast<uint8_t>((thermistor % bms_pack_layout::THERMISTORS_PER_CHIP) / 3);
+        }
+        return table;
+    }();
+
+    /**
+     * @return true if the chip has cells in CV group cv_group (0-3 = A-D)
+     */
+    static constexpr bool chip_has_cv_group(size_t chip, size_t cv_group)
+    {
+        return cv_group < chip_num_cv_groups[chip];
+    }
+};
+
+using ACUPackTopology = BMSPackTopology<bms_pack_layout::NUM_CHIPS, bms_pack_layout::NUM_CHIP_SELECTS>;
+
+#endif
@@ -12,12 +12,13 @@
 #include "FlexCAN_T4.h"
 #include "SharedFirmwareTypes.h"
 #include "shared_types.h"
+#include "BMSPackTopology.h"
 
 namespace ccu_interface_defaults{
     constexpr const uint16_t MIN_CHARGING_ENABLE_THRESHOLD_MS = 1000;
-    constexpr const size_t NUM_CELLS = 126;
-    constexpr const size_t NUM_CELLTEMPS = 48;
-    constexpr const size_t NUM_CHIPS = 12;
+    constexpr const size_t NUM_CELLS = ACUPackTopology::num_cells;
+    constexpr const size_t NUM_CELLTEMPS = ACUPackTopology::num_cell_temps;
+    constexpr const size_t NUM_CHIPS = bms_pack_layout::NUM_CHIPS;
 };
 
 struct CCUCANInterfaceData_s
@@ -80,7 +81,7 @@ public:
     CCUCANInterfaceData_s get_latest_data(unsigned long curr_millis);
 
     template <size_t num_cells, size_t num_celltemps, size_t num_chips>
-    void set_ACU_data(ACUAllData_s<num_cells, num_celltemps, num_chips> input)
+    void set_ACU_data(const ACUAllData_s<num_cells, num_celltemps, num_chips> &input)
     {
         _acu_core_data.avg_cell_voltage = input.core_data.avg_cell_voltage;
         _acu_core_data.max_cell_voltage = input.core_data.max_cell_voltage;
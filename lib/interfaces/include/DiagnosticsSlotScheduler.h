@@ -0,0 +1,120 @@
+#ifndef DIAGNOSTICS_SLOT_SCHEDULER_H
+#define DIAGNOSTICS_SLOT_SCHEDULER_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stddef.h>
+
+/**
+ * Background self tests of the LTC6811 stack, in the order DiagnosticsSlotScheduler runs them
+ */
+enum class BMSDiagnostic_e
+{
+    OPEN_WIRE = 0,       // ADOW with pull-up and pull-down currents, compared cell by cell
+    MUX_SELF_TEST,       // DIAGN, then MUXFAIL / THSD from status group B
+    CELL_SC_CROSS_CHECK, // ADCVSC, the cells of one conversion summed against its sum of cells
+    NUM_DIAGNOSTICS
+};
+
+constexpr const size_t NUM_BMS_DIAGNOSTICS = static_cast<size_t>(BMSDiagnostic_e::NUM_DIAGNOSTICS);
+
+struct DiagnosticsSlotStats_s
+{
+    std::array<uint32_t, NUM_BMS_DIAGNOSTICS> runs = {};
+    std::array<uint32_t, NUM_BMS_DIAGNOSTICS> last_duration_us = {};
+    uint32_t slots_deferred = 0;  // slots where the next diagnostic did not fit the budget left
+    uint32_t slots_too_short = 0; // slots where it fit the budget, but not the time the slot had
+    uint64_t bus_time_used_us = 0;
+};
+
+/**
+ * Decides when the next diagnostic may run under a bus time budget of budget_us_per_s.
+ *
+ * The budget is a token bucket: it fills at budget_us_per_s and holds at most one second of it, a diagnostic only
+ * starts once the bucket holds its expected duration, and its measured duration is taken out afterwards. The
+ * expected duration is the last measured one (the initial estimate until the first run). Diagnostics take turns,
+ * one that doesn't fit holds the others back rather than being skipped, so none of them starves.
+ * A diagnostic also only starts in a slot at least its expected duration long, so it never runs past the slot.
+ * A budget of 0 never runs anything.
+ */
+class DiagnosticsSlotScheduler
+{
+public:
+    DiagnosticsSlotScheduler(uint32_t budget_us_per_s, const std::array<uint32_t, NUM_BMS_DIAGNOSTICS> &initial_duration_estimates_us)
+        : _budget_us_per_s(budget_us_per_s),
+          _expected_duration_us(initial_duration_estimates_us)
+    {
+    }
+
+    /**
+     * @param now_us micros() when the slot opens
+     * @param slot_us time the slot has before whatever comes after it is due
+     * @return the diagnostic to run now, NUM_DIAGNOSTICS if the budget left or the slot doesn't cover the next one
+     */
+    BMSDiagnostic_e next(uint32_t now_us, uint32_t slot_us = UINT32_MAX)
+    {
+        _refill(now_us);
+        const size_t slot = static_cast<size_t>(_next_diagnostic);
+        if (_budget_us_per_s == 0 || _available < static_cast<int64_t>(_expected_duration_us[slot]) * scale)
+        {
+            _stats.slots_deferred++;
+            return BMSDiagnostic_e::NUM_DIAGNOSTICS;
+        }
+        if (_expected_duration_us[slot] > slot_us)
+        {
+            _stats.slots_too_short++;
+            return BMSDiagnostic_e::NUM_DIAGNOSTICS;
+        }
+        return _next_diagnostic;
+    }
+
+    /**
+     * Charges a diagnostic returned by next() to the budget and moves on to the next one
+     */
+    void record_run(BMSDiagnostic_e diagnostic, uint32_t duration_us)
+    {
+        const size_t slot = static_cast<size_t>(diagnostic);
+        _available -= static_cast<int64_t>(duration_us) * scale;
+        _expected_duration_us[slot] = duration_us;
+        _stats.runs[slot]++;
+        _stats.last_duration_us[slot] = duration_us;
+        _stats.bus_time_used_us += duration_us;
+        _next_diagnostic = static_cast<BMSDiagnostic_e>((slot + 1) % NUM_BMS_DIAGNOSTICS);
+    }
+
+    /**
+     * @return budget in the bucket as of the last call to next(), negative right after a run longer than expected
+     */
+    int64_t get_available_us() const { return _available / scale; }
+
+    const DiagnosticsSlotStats_s &get_stats() const { return _stats; }
+
+private:
+    /**
+     * Budget is counted in us * 1e6, so every microsecond of elapsed time earns budget_us_per_s of it without rounding
+     */
+    static constexpr int64_t scale = 1000000;
+
+    void _refill(uint32_t now_us)
+    {
+        if (_refilled_once)
+        {
+            const int64_t earned = static_cast<int64_t>(now_us - _last_refill_us) * _budget_us_per_s;
+            _available = std::min<int64_t>(_available + earned, static_cast<int64_t>(_budget_us_per_s) * scale);
+        }
+        _last_refill_us = now_us;
+        _refilled_once = true;
+    }
+
+    const uint32_t _budget_us_per_s;
+    std::array<uint32_t, NUM_BMS_DIAGNOSTICS> _expected_duration_us;
+
+    BMSDiagnostic_e _next_diagnostic = BMSDiagnostic_e::OPEN_WIRE;
+    int64_t _available = 0;
+    uint32_t _last_refill_us = 0;
+    bool _refilled_once = false;
+    DiagnosticsSlotStats_s _stats = {};
+};
+
+#endif
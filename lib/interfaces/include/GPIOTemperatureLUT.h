@@ -0,0 +1,154 @@
+#ifndef GPIO_TEMPERATURE_LUT_H
+#define GPIO_TEMPERATURE_LUT_H
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stddef.h>
+
+/**
+ * Raw LTC6811 GPIO code (100 uV / LSB) -> temperature conversions for the sensors on the BMS boards.
+ *
+ * The exact formulas are kept here as constexpr functions and used to generate lookup tables at compile time,
+ * so a reading is a table lookup and one linear interpolation in single precision instead of a double
+ * precision log and divisions per sample.
+ */
+namespace gpio_temperature_lut
+{
+    // Cell thermistors: NTC (10k at 25 C, Beta 3984) against a 2.74k resistor, ratiometric to the 5 V reference
+    constexpr const double THERMISTOR_DIVIDER_OHMS = 2740.0;
+    constexpr const double THERMISTOR_FULL_SCALE_CODE = 50000.0; // 5 V at 100 uV / LSB
+    constexpr const double THERMISTOR_R25_OHMS = 10000.0;
+    constexpr const double THERMISTOR_T25_K = 298.15;
+    constexpr const double THERMISTOR_BETA = 3984.0;
+    constexpr const double THERMISTOR_KELVIN_OFFSET = 272.15; // offset the driver has always used
+
+    // Board temperature: MCP9701, 19.5 mV / C with 400 mV at 0 C
+    constexpr const double MCP9701_CODE_PER_VOLT = 10000.0;
+    constexpr const double MCP9701_V_PER_C = 0.0195;
+    constexpr const double MCP9701_V_AT_0C = 0.4;
+
+    /**
+     * Natural log that can run at compile time: x = m * 2^k with m in [1, 2), ln(m) = 2 atanh((m - 1) / (m + 1))
+     * @pre x is positive and finite
+     */
+    constexpr double constexpr_log(double x)
+    {
+        constexpr double ln2 = 0.69314718055994530942;
+        int k = 0;
+        while (x >= 2.0)
+        {
+            x /= 2.0;
+            k++;
+        }
+        while (x < 1.0)
+        {
+            x *= 2.0;
+            k--;
+        }
+        const double y = (x - 1.0) / (x + 1.0);
+        const double y2 = y * y;
+        double term = y;
+        double sum = 0.0;
+        for (int n = 1; n < 60; n += 2)
+        {
+            sum += term / n;
+            term *= y2;
+        }
+        return (2.0 * sum) + (k * ln2);
+    }
+
+    /**
+     * The Beta equation the driver used per sample, @pre 0 < gpio_code < THERMISTOR_FULL_SCALE_CODE
+     */
+    constexpr double thermistor_celsius(double gpio_code)
+    {
+        const double thermistor_resistance = (THERMISTOR_DIVIDER_OHMS / (gpio_code / THERMISTOR_FULL_SCALE_CODE)) - THERMISTOR_DIVIDER_OHMS;
+        return 1.0 / ((1.0 / THERMISTOR_T25_K) + (1.0 / THERMISTOR_BETA) * constexpr_log(thermistor_resistance / THERMISTOR_R25_OHMS)) - THERMISTOR_KELVIN_OFFSET;
+    }
+
+    constexpr double mcp9701_celsius(double gpio_code)
+    {
+        return ((gpio_code / MCP9701_CODE_PER_VOLT) - MCP9701_V_AT_0C) / MCP9701_V_PER_C;
+    }
+
+    /**
+     * Temperatures at evenly spaced GPIO codes, first_code + n * 2^step_shift, linearly interpolated in between
+     */
+    template <size_t num_points, uint8_t step_shift>
+    struct GPIOCodeLUT_s
+    {
+        uint16_t first_code;
+        std::array<float, num_points> celsius;
+
+        static constexpr uint32_t step = 1UL << step_shift;
+
+        /**
+         * @return true if code lies inside the table, outside it convert() clamps to the end points
+         */
+        constexpr bool in_range(uint16_t code) const
+        {
+            return code >= first_code && (static_cast<uint32_t>(code) - first_code) < ((num_points - 1) * step);
+        }
+
+        constexpr float convert(uint16_t code) const
+        {
+            if (code < first_code)
+            {
+                return celsius[0];
+            }
+            const uint32_t offset = static_cast<uint32_t>(code) - first_code;
+            const uint32_t index = offset >> step_shift;
+            if (index >= num_points - 1)
+            {
+                return celsius[num_points - 1];
+            }
+            const float fraction = static_cast<float>(offset & (step - 1)) * (1.0f / step);
+            return celsius[index] + ((celsius[index + 1] - celsius[index]) * fraction);
+        }
+    };
+
+    template <size_t num_points, uint8_t step_shift, typename conversion_t>
+    constexpr GPIOCodeLUT_s<num_points, step_shift> make_gpio_code_lut(uint16_t first_code, conversion_t conversion)
+    {
+        GPIOCodeLUT_s<num_points, step_shift> lut{first_code, {}};
+        for (size_t point = 0; point < num_points; point++)
+        {
+            lut.celsius[point] = static_cast<float>(conversion(static_cast<double>(first_code) + static_cast<double>(point << step_shift)));
+        }
+        return lut;
+    }
+
+    /**
+     * Codes 256 - 46336 (about -42 C to 146 C) in steps of 64. Past that the thermistor is open / shorted or far
+     * outside anything the cells see, and the Beta equation runs into its pole near full scale.
+     */
+    inline constexpr auto THERMISTOR_LUT = make_gpio_code_lut<721, 6>(256, thermistor_celsius);
+
+    /**
+     * The MCP9701 is linear, so the table only exists to keep both sensors on one conversion path. Covers every code.
+     */
+    inline constexpr auto MCP9701_LUT = make_gpio_code_lut<257, 8>(0, mcp9701_celsius);
+
+    /**
+     * @return the cell thermistor temperature; codes outside the table use the exact equation so faulted sensors
+     * read exactly what they always did
+     */
+    inline float thermistor_code_to_celsius(uint16_t gpio_code)
+    {
+        if (THERMISTOR_LUT.in_range(gpio_code))
+        {
+            return THERMISTOR_LUT.convert(gpio_code);
+        }
+        // std::log rather than constexpr_log: at 0 / full scale the resistance is infinite / not positive
+        const double thermistor_resistance = (THERMISTOR_DIVIDER_OHMS / (gpio_code / THERMISTOR_FULL_SCALE_CODE)) - THERMISTOR_DIVIDER_OHMS;
+        return 1.0 / ((1.0 / THERMISTOR_T25_K) + (1.0 / THERMISTOR_BETA) * std::log(thermistor_resistance / THERMISTOR_R25_OHMS)) - THERMISTOR_KELVIN_OFFSET;
+    }
+
+    inline float mcp9701_code_to_celsius(uint16_t gpio_code)
+    {
+        return MCP9701_LUT.convert(gpio_code);
+    }
+}
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef GROUP_READ_SCHEDULER_H
+#define GROUP_READ_SCHEDULER_H
+
+#include <array>
+#include <cstdint>
+#include <stddef.h>
+
+#include "shared_types.h"
+
+/**
+ * How often each register group was read by a GroupReadScheduler
+ */
+struct GroupVisitStats_s
+{
+    std::array<uint32_t, ReadGroup_e::NUM_GROUPS> visits = {};
+    std::array<uint16_t, ReadGroup_e::NUM_GROUPS> max_reads_between_visits = {}; // reads of other groups between two reads of this one
+    uint32_t total_visits = 0;
+    uint32_t staleness_visits = 0; // picks restricted to groups about to go past the staleness bound
+};
+
+/**
+ * Weighted order to read the six register groups in, one group per read.
+ *
+ * Every group has weight 1, the "hot" groups (set_hot_groups()) get hot_weight, and the groups are picked by
+ * smooth weighted round robin: each pick every group gains its weight in credit, the group with the most credit is
+ * read and pays the total weight back. A group with weight w out of a total W is read w / W of the time, spread evenly.
+ *
+ * On top of that no group goes more than max_staleness reads of other groups without being read. Each group has a
+ * deadline, the picks left before it would go past that bound. Whenever k groups are due within the next k picks the
+ * pick is restricted to them (still by credit), which is exactly when picking by weight alone could miss one. Nothing
+ * is forced otherwise, so the weights only give way when the bound is about to be hit. max_staleness is raised to
+ * NUM_GROUPS - 1 if it is below, the gap of plain round robin.
+ */
+class GroupReadScheduler
+{
+public:
+    GroupReadScheduler(uint8_t hot_weight, uint16_t max_staleness)
+        : _hot_weight(hot_weight == 0 ? 1 : hot_weight),
+          _max_staleness(max_staleness < ReadGroup_e::NUM_GROUPS - 1 ? ReadGroup_e::NUM_GROUPS - 1 : max_staleness)
+    {
+    }
+
+    /**
+     * @param hot_group_mask bit n set gives ReadGroup_e n the hot weight, from the next pick on
+     */
+    void set_hot_groups(uint8_t hot_group_mask)
+    {
+        _hot_group_mask = hot_group_mask;
+    }
+
+    uint8_t get_hot_groups() const { return _hot_group_mask; }
+
+    /**
+     * Picks the group to read next and counts it as read
+     */
+    ReadGroup_e next()
+    {
+        int32_t total_weight = 0;
+        for (size_t group = 0; group < ReadGroup_e::NUM_GROUPS; group++)
+        {
+            const int32_t weight = ((_hot_group_mask >> group) & 1U) ? _hot_weight : 1;
+            _credit[group] += weight;
+            total_weight += weight;
+        }
+
+        // Deadline = picks left, this one included, before a group goes past max_staleness. With k groups due
+        // within k picks (a tight set) the pick has to come from the smallest such set or one of them misses
+        std::array<uint16_t, ReadGroup_e::NUM_GROUPS> deadline = {};
+        for (size_t group = 0; group < ReadGroup_e::NUM_GROUPS; group++)
+        {
+            deadline[group] = _max_staleness + 1 - _reads_since_visit[group];
+        }
+        uint16_t pick_within = UINT16_MAX;
+        for (uint16_t picks = 1; picks <= ReadGroup_e::NUM_GROUPS; picks++)
+        {
+            size_t due = 0;
+            for (size_t group = 0; group < ReadGroup_e::NUM_GROUPS; group++)
+            {
+                due += (deadline[group] <= picks);
+            }
+            if (due >= picks)
+            {
+                pick_within = picks;
+                break;
+            }
+        }
+
+        size_t pick = ReadGroup_e::NUM_GROUPS;
+        for (size_t group = 0; group < ReadGroup_e::NUM_GROUPS; group++)
+        {
+            if (deadline[group] <= pick_within && (pick == ReadGroup_e::NUM_GROUPS || _credit[group] > _credit[pick]))
+            {
+                pick = group;
+            }
+        }
+        if (pick_within != UINT16_MAX)
+        {
+            _stats.staleness_visits++;
+        }
+        _credit[pick] -= total_weight;
+
+        for (size_t group = 0; group < ReadGroup_e::NUM_GROUPS; group++)
+        {
+            if (group == pick)
+            {
+                continue;
+            }
+            _reads_since_visit[group]++;
+        }
+        if (_stats.visits[pick] > 0 && _reads_since_visit[pick] > _stats.max_reads_between_visits[pick])
+        {
+            _stats.max_reads_between_visits[pick] = _reads_since_visit[pick];
+        }
+        _reads_since_visit[pick] = 0;
+        _stats.visits[pick]++;
+        _stats.total_visits++;
+        return static_cast<ReadGroup_e>(pick);
+    }
+
+    const GroupVisitStats_s &get_visit_stats() const { return _stats; }
+
+    /**
+     * @return share of all reads that went to group, 0 before the first read
+     */
+    float get_visit_frequency(ReadGroup_e group) const
+    {
+        return (_stats.total_visits == 0) ? 0.0f : static_cast<float>(_stats.visits[group]) / static_cast<float>(_stats.total_visits);
+    }
+
+private:
+    const int32_t _hot_weight;
+    const uint16_t _max_staleness;
+
+    uint8_t _hot_group_mask = 0;
+    std::array<int32_t, ReadGroup_e::NUM_GROUPS> _credit = {};
+    std::array<uint16_t, ReadGroup_e::NUM_GROUPS> _reads_since_visit = {};
+    GroupVisitStats_s _stats = {};
+};
+
+#endif
@@ -0,0 +1,375 @@
+#ifndef LTC_COMMAND_FRAMES_H
+#define LTC_COMMAND_FRAMES_H
+
+#include <array>
+#include <cstdint>
+#include <stddef.h>
+
+#include "shared_types.h"
+
+// Command Codes
+enum class CMD_CODES_e
+{
+    // WRITES
+    WRITE_CONFIG = 0x1,
+    WRITE_S_CONTROL = 0x14,
+    WRITE_PWM = 0x20,
+    WRITE_COMM = 0x721,
+    // READS
+    READ_CONFIG = 0x2,
+    READ_CELL_VOLTAGE_GROUP_A = 0x4,
+    READ_CELL_VOLTAGE_GROUP_B = 0x6,
+    READ_CELL_VOLTAGE_GROUP_C = 0x8,
+    READ_CELL_VOLTAGE_GROUP_D = 0xA,
+    READ_GPIO_VOLTAGE_GROUP_A = 0xC,
+    READ_GPIO_VOLTAGE_GROUP_B = 0xE,
+    READ_STATUS_GROUP_A = 0x10,
+    READ_STATUS_GROUP_B = 0x12,
+    READ_S_CONTROL = 0x16,
+    READ_PWM = 0x22,
+    READ_COMM = 0x722,
+    // STARTS
+    START_S_CONTROL = 0x19,
+    START_CV_ADC_CONVERSION = 0x260,
+    START_GPIO_ADC_CONVERSION = 0x460,
+    START_CV_GPIO_ADC_CONVERSION = 0x46F,
+    START_CV_SC_CONVERSION = 0x467,
+    START_STATUS_ADC_CONVERSION = 0x468,
+    START_OPEN_WIRE_CONVERSION = 0x228,
+    START_COMM = 0x723,
+    // CLEARS
+    CLEAR_S_CONTROL = 0x18,
+    CLEAR_GPIOS = 0x712,
+    CLEAR_STATUS = 0x713,
+    // POLL ADC STATUS, DIAGNOSE MUX
+    POLL_ADC_STATUS = 0x714,
+    DIAGNOSE_MUX_POLL_STATUS = 0x715
+};
+
+/**
+ * Ready-to-send command frames for the LTC6811-1 (broadcast) command set.
+ *
+ * Every broadcast command is a fixed 2 byte code followed by its 2 byte PEC, so none of it has to be
+ * recomputed while the driver is running. Everything in here is constexpr: the defaults can be built at
+ * compile time, and a driver with a runtime config builds its table exactly once at construction.
+ * Reference pages 55-60 (command codes) and 76 (PEC) of the data sheet:
+ * https://www.analog.com/media/en/technical-documentation/data-sheets/LTC6811-1-6811-2.pdf
+ */
+namespace ltc_command_frames
+{
+    using PEC15Table = std::array<uint16_t, 256>;
+    using CmdPEC = std::array<uint8_t, 4>;
+
+    constexpr const size_t NUM_ADC_MODES = 4; // MD[1:0], indexed the same as ADC_MODE_e
+    constexpr const uint8_t CHST_SUM_OF_CELLS = 0x1; // ADSTAT channel select: SC only
+    constexpr const uint16_t OPEN_WIRE_PULL_UP = 0x40; // ADOW PUP bit, pull-up instead of pull-down current
+    // CFGR bits that read back what was written: REFON + ADCOPT (GPIOx reads the pin level, DTEN the pin strap),
+    // VUV / VOV, DCC1-12. DCTO is left out, it reads back the timer state
+    constexpr const std::array<uint8_t, 6> CONFIG_READBACK_MASK = {0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F};
+    constexpr const int32_t OPEN_WIRE_DELTA_CODE = -4000; // pull-up minus pull-down below -400 mV: the wire below the cell is open
+
+    /**
+     * Builds the CRC15 lookup table. This is the data sheet implementation from page 76.
+     */
+    constexpr PEC15Table make_pec15_table(uint16_t crc15_poly)
+    {
+        PEC15Table table{};
+        for (int i = 0; i < 256; i++)
+        {
+            uint16_t remainder = i << 7;
+            for (int bit = 8; bit > 0; --bit)
+            {
+                if (remainder & 0x4000)
+                {
+                    remainder = ((remainder << 1));
+                    remainder = (remainder ^ crc15_poly);
+                }
+                else
+                {
+                    remainder = ((remainder << 1));
+                }
+            }
+            table[i] = remainder & 0xFFFF;
+        }
+        return table;
+    }
+
+    /**
+     * Calculates the 2 byte PEC (MSB first) of a data buffer
+     */
+    constexpr std::array<uint8_t, 2> calculate_pec(const PEC15Table &table, const uint8_t *data, size_t length)
+    {
+        uint16_t remainder = 0x10; // PEC seed
+        for (size_t i = 0; i < length; i++)
+        {
+            uint16_t addr = ((remainder >> 7) ^ data[i]) & 0xff; // calculate PEC table address
+            remainder = (remainder << 8) ^ table[addr];
+        }
+        remainder = remainder * 2; // The CRC15 has a 0 in the LSB so the final value must be multiplied by 2
+        return {static_cast<uint8_t>((remainder >> 8) & 0xFF), static_cast<uint8_t>(remainder & 0xFF)};
+    }
+
+    /**
+     * Two 256 entry tables that let the CRC15 eat a 16 bit word per step instead of a byte.
+     * [0] is the byte table itself (the low byte of a word), [1] is the same byte followed by a zero byte.
+     */
+    using PEC15SliceTable = std::array<PEC15Table, 2>;
+
+    constexpr PEC15SliceTable make_pec15_slice_table(const PEC15Table &table)
+    {
+        PEC15SliceTable slices{};
+        for (int i = 0; i < 256; i++)
+        {
+            slices[0][i] = table[i];
+            // Byte i then a zero byte, run through the byte-wise loop of calculate_pec() from a zero remainder
+            const uint16_t remainder = table[i];
+            slices[1][i] = static_cast<uint16_t>((remainder << 8) ^ table[(remainder >> 7) & 0xff]);
+        }
+        return slices;
+    }
+
+    /**
+     * Same result as calculate_pec(), two bytes per table step
+     * @param num_words length of data in 16 bit words (MSB first)
+     * @return the PEC as PEC0 << 8 | PEC1
+     */
+    constexpr uint16_t calculate_pec_wordwise(const PEC15SliceTable &slices, const uint8_t *data, size_t num_words)
+    {
+        uint16_t remainder = 0x10; // PEC seed
+        for (size_t i = 0; i < num_words; i++)
+        {
+            // The 15 bit remainder lines up with the word once shifted left by one
+            const uint16_t index = static_cast<uint16_t>((remainder << 1) ^ ((data[2 * i] << 8) | data[(2 * i) + 1]));
+            remainder = slices[1][index >> 8] ^ slices[0][index & 0xff];
+        }
+        return static_cast<uint16_t>(remainder << 1);
+    }
+
+    /**
+     * Checks the PEC of every chip in one chip select's register group response (6 data bytes + 2 PEC bytes per chip)
+     * in a single pass, before any of it is decoded
+     * @return bit n set if chip n's PEC matched
+     */
+    template <size_t num_chips_on_cs>
+    constexpr uint32_t validate_group_response_pecs(const PEC15SliceTable &slices, const std::array<uint8_t, 8 * num_chips_on_cs> &response)
+    {
+        static_assert(num_chips_on_cs <= 32, "Validity mask is 32 bits wide");
+        uint32_t valid_mask = 0;
+        for (size_t chip = 0; chip < num_chips_on_cs; chip++)
+        {
+            const uint8_t *packet = response.data() + (8 * chip);
+            const uint16_t received_pec = static_cast<uint16_t>((packet[6] << 8) | packet[7]);
+            valid_mask |= static_cast<uint32_t>(calculate_pec_wordwise(slices, packet, 3) == received_pec) << chip;
+        }
+        return valid_mask;
+    }
+
+    /**
+     * Pulls the cell comparator flags out of one chip's Status Register Group B. STBR2-4 hold four cells each,
+     * as C(n+3)OV C(n+3)UV ... CnOV CnUV from bit 7 down
+     * @param status_b the chip's 6 STBR data bytes
+     * @param over_voltage true for the CxOV flags, false for the CxUV flags
+     * @return bit n set if cell n (0 = C1) is flagged
+     */
+    constexpr uint16_t decode_cell_voltage_flags(const uint8_t *status_b, bool over_voltage)
+    {
+        uint16_t flags = 0;
+        for (size_t cell = 0; cell < 12; cell++)
+        {
+            const uint8_t bit = static_cast<uint8_t>(((cell % 4) * 2) + (over_voltage ? 1 : 0));
+            flags |= static_cast<uint16_t>((status_b[2 + (cell / 4)] >> bit) & 1U) << cell;
+        }
+        return flags;
+    }
+
+    /**
+     * @param status_a one chip's 6 STAR data bytes
+     * @return the sum of cells code (STAR0-1), 20 cell LSBs (2 mV) per LSB
+     */
+    constexpr uint16_t decode_sum_of_cells_code(const uint8_t *status_a)
+    {
+        return static_cast<uint16_t>(status_a[0] | (status_a[1] << 8));
+    }
+
+    /**
+     * @param config_read one chip's 6 CFGR data bytes as read back with RDCFG
+     * @param config_written the 6 CFGR bytes written to it
+     * @return true if every bit that reads back (CONFIG_READBACK_MASK) matches
+     */
+    constexpr bool config_readback_matches(const uint8_t *config_read, const std::array<uint8_t, 6> &config_written)
+    {
+        for (size_t i = 0; i < 6; i++)
+        {
+            if (((config_read[i] ^ config_written[i]) & CONFIG_READBACK_MASK[i]) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @param status_b one chip's 6 STBR data bytes
+     * @return MUXFAIL (STBR5 bit 1), set if the last DIAGN found the multiplexer broken
+     */
+    constexpr bool decode_mux_fail(const uint8_t *status_b)
+    {
+        return (status_b[5] >> 1) & 1U;
+    }
+
+    /**
+     * @param status_b one chip's 6 STBR data bytes
+     * @return THSD (STBR5 bit 0), latched once the die overheated until the status registers are cleared
+     */
+    constexpr bool decode_thermal_shutdown(const uint8_t *status_b)
+    {
+        return status_b[5] & 1U;
+    }
+
+    /**
+     * The datasheet's open wire check on one chip, from the cell codes after ADOW with pull-up and with pull-down
+     * current. Wire Cn is open if cell n + 1 reads 400 mV lower with pull-up than with pull-down, C0 if cell 1 reads
+     * 0 with pull-up and the top wire if the top cell reads 0 with pull-down
+     * @param num_cells cells on the chip, from C1 up
+     * @return bit n set if wire Cn (0 = C0, the chip's bottom) is open
+     */
+    constexpr uint16_t decode_open_wires(const std::array<uint16_t, 12> &pull_up_codes, const std::array<uint16_t, 12> &pull_down_codes, size_t num_cells)
+    {
+        if (num_cells == 0)
+        {
+            return 0;
+        }
+        uint16_t open_wires = 0;
+        if (pull_up_codes[0] == 0)
+        {
+            open_wires |= 1U;
+        }
+        for (size_t cell = 1; cell < num_cells; cell++)
+        {
+            if (static_cast<int32_t>(pull_up_codes[cell]) - static_cast<int32_t>(pull_down_codes[cell]) < OPEN_WIRE_DELTA_CODE)
+            {
+                open_wires |= static_cast<uint16_t>(1U << cell);
+            }
+        }
+        if (pull_down_codes[num_cells - 1] == 0)
+        {
+            open_wires |= static_cast<uint16_t>(1U << num_cells);
+        }
+        return open_wires;
+    }
+
+    /**
+     * @return CMD0, CMD1, PEC0, PEC1 for a broadcast command code
+     */
+    constexpr CmdPEC make_cmd_pec(const PEC15Table &table, uint16_t cmd_code)
+    {
+        const uint8_t cmd[2] = {static_cast<uint8_t>(cmd_code >> 8), static_cast<uint8_t>(cmd_code)};
+        const std::array<uint8_t, 2> pec = calculate_pec(table, cmd, 2);
+        return {cmd[0], cmd[1], pec[0], pec[1]};
+    }
+
+    /**
+     * Packs the ADC mode, discharge permitted and channel select bits into an ADC start command code
+     */
+    constexpr uint16_t make_adc_cmd_code(CMD_CODES_e command, uint8_t adc_mode, uint8_t discharge_permitted, uint8_t channel_select)
+    {
+        return static_cast<uint16_t>(command) | ((adc_mode & 0x3) << 7) | ((discharge_permitted & 0x1) << 4) | (channel_select & 0x7);
+    }
+
+    /**
+     * Every command the driver sends, already formatted and PEC'd
+     */
+    struct CommandFrameTable_s
+    {
+        // Register group reads, indexed by ReadGroup_e
+        std::array<CmdPEC, ReadGroup_e::NUM_GROUPS> read_group;
+
+        // WRITES
+        CmdPEC write_config;
+        CmdPEC write_s_control;
+        CmdPEC write_pwm;
+        CmdPEC write_comm;
+
+        // READS
+        CmdPEC read_config;
+        CmdPEC read_status_a;
+        CmdPEC read_status_b;
+        CmdPEC read_s_control;
+        CmdPEC read_pwm;
+        CmdPEC read_comm;
+
+        // STARTS, indexed by ADC mode so the conversion speed can be switched without a PEC
+        std::array<CmdPEC, NUM_ADC_MODES> start_cv_adc;
+        std::array<CmdPEC, NUM_ADC_MODES> start_gpio_adc;
+        std::array<CmdPEC, NUM_ADC_MODES> start_cv_gpio_adc;
+        std::array<CmdPEC, NUM_ADC_MODES> start_cv_sc_adc;
+        std::array<CmdPEC, NUM_ADC_MODES> start_status_sc_adc; // ADSTAT, sum of cells only
+        std::array<CmdPEC, NUM_ADC_MODES> start_open_wire_pull_up;   // ADOW, PUP = 1, all cells
+        std::array<CmdPEC, NUM_ADC_MODES> start_open_wire_pull_down; // ADOW, PUP = 0, all cells
+        CmdPEC start_s_control;
+        CmdPEC start_comm;
+
+        // CLEARS
+        CmdPEC clear_s_control;
+        CmdPEC clear_gpios;
+        CmdPEC clear_status;
+
+        // POLL ADC STATUS, DIAGNOSE MUX
+        CmdPEC poll_adc_status;
+        CmdPEC diagnose_mux;
+    };
+
+    /**
+     * @param discharge_permitted DCP bit used by the cell conversions
+     * @param cell_select_mode CH bits used by the cell conversion
+     * @note the GPIO conversion always converts every GPIO (CHG = 0), the same as the driver always has
+     */
+    constexpr CommandFrameTable_s make_command_frame_table(const PEC15Table &table, uint8_t discharge_permitted, uint8_t cell_select_mode)
+    {
+        CommandFrameTable_s frames{};
+
+        frames.read_group[ReadGroup_e::CV_GROUP_A] = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_A));
+        frames.read_group[ReadGroup_e::CV_GROUP_B] = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_B));
+        frames.read_group[ReadGroup_e::CV_GROUP_C] = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_C));
+        frames.read_group[ReadGroup_e::CV_GROUP_D] = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_D));
+        frames.read_group[ReadGroup_e::AUX_GROUP_A] = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_GPIO_VOLTAGE_GROUP_A));
+        frames.read_group[ReadGroup_e::AUX_GROUP_B] = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_GPIO_VOLTAGE_GROUP_B));
+
+        frames.write_config = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::WRITE_CONFIG));
+        frames.write_s_control = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::WRITE_S_CONTROL));
+        frames.write_pwm = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::WRITE_PWM));
+        frames.write_comm = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::WRITE_COMM));
+
+        frames.read_config = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_CONFIG));
+        frames.read_status_a = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_STATUS_GROUP_A));
+        frames.read_status_b = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_STATUS_GROUP_B));
+        frames.read_s_control = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_S_CONTROL));
+        frames.read_pwm = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_PWM));
+        frames.read_comm = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::READ_COMM));
+
+        for (size_t mode = 0; mode < NUM_ADC_MODES; mode++)
+        {
+            const uint8_t md = static_cast<uint8_t>(mode);
+            frames.start_cv_adc[mode] = make_cmd_pec(table, make_adc_cmd_code(CMD_CODES_e::START_CV_ADC_CONVERSION, md, discharge_permitted, cell_select_mode));
+            frames.start_gpio_adc[mode] = make_cmd_pec(table, make_adc_cmd_code(CMD_CODES_e::START_GPIO_ADC_CONVERSION, md, 0, 0));
+            frames.start_cv_gpio_adc[mode] = make_cmd_pec(table, make_adc_cmd_code(CMD_CODES_e::START_CV_GPIO_ADC_CONVERSION, md, discharge_permitted, 0));
+            frames.start_cv_sc_adc[mode] = make_cmd_pec(table, make_adc_cmd_code(CMD_CODES_e::START_CV_SC_CONVERSION, md, discharge_permitted, 0));
+            frames.start_status_sc_adc[mode] = make_cmd_pec(table, make_adc_cmd_code(CMD_CODES_e::START_STATUS_ADC_CONVERSION, md, 0, CHST_SUM_OF_CELLS));
+            frames.start_open_wire_pull_up[mode] = make_cmd_pec(table, make_adc_cmd_code(CMD_CODES_e::START_OPEN_WIRE_CONVERSION, md, discharge_permitted, 0) | OPEN_WIRE_PULL_UP);
+            frames.start_open_wire_pull_down[mode] = make_cmd_pec(table, make_adc_cmd_code(CMD_CODES_e::START_OPEN_WIRE_CONVERSION, md, discharge_permitted, 0));
+        }
+        frames.start_s_control = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::START_S_CONTROL));
+        frames.start_comm = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::START_COMM));
+
+        frames.clear_s_control = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::CLEAR_S_CONTROL));
+        frames.clear_gpios = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::CLEAR_GPIOS));
+        frames.clear_status = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::CLEAR_STATUS));
+
+        frames.poll_adc_status = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::POLL_ADC_STATUS));
+        frames.diagnose_mux = make_cmd_pec(table, static_cast<uint16_t>(CMD_CODES_e::DIAGNOSE_MUX_POLL_STATUS));
+
+        return frames;
+    }
+}
+
+#endif
@@ -3,10 +3,35 @@
 
 /* Interface Includes */
 #include <SPI.h>
+#include <EventResponder.h>
 #include <stddef.h>
 #include <array>
 
+#include "LTCSPITransferEngine.h"
+
 namespace ltc_spi_interface {
+    constexpr const uint32_t DEFAULT_SPI_CLOCK_HZ = 1000000; // isoSPI (LTC6820) is specified up to 1 Mbps
+    constexpr const int MAX_CHIP_SELECT_PIN = 63;
+
+    /**
+     * SPI clock per chip select pin, 0 = DEFAULT_SPI_CLOCK_HZ. Every command below looks its clock up here,
+     * so each isoSPI segment can run at its own speed.
+     */
+    inline std::array<uint32_t, MAX_CHIP_SELECT_PIN + 1> _spi_clock_hz_per_cs = {};
+
+    /**
+     * Sets the SPI clock used for every transfer on one chip select, takes effect on the next transfer
+     * @param clock_hz clamped to DEFAULT_SPI_CLOCK_HZ
+     */
+    inline void set_spi_clock(int cs, uint32_t clock_hz);
+
+    /**
+     * @return the SPI clock used for transfers on cs
+     */
+    inline uint32_t get_spi_clock(int cs);
+
+    inline SPISettings _spi_settings(int cs);
+
     /**
      * Sends a SPI command to write data to the registers
      * @param cs chip select
@@ -33,8 +58,52 @@ namespace ltc_spi_interface {
     */
     inline void adc_conversion_command(int cs, std::array<uint8_t, 4> cmd_and_pec, size_t num_stacked_devices);
 
+    /**
+     * Sends PLADC and clocks one status byte back
+     * @param cs chip select
+     * @param cmd_and_pec PLADC command + PEC
+     * @return true once every device on the chain finished its conversion (isoSPI reads back 0 while any is busy)
+    */
+    inline bool poll_adc_status_command(int cs, std::array<uint8_t, 4> cmd_and_pec);
+
     inline void _write_and_delay_high(int cs, int delay_microSeconds);
 
+    /**
+     * DMA transfer backend for AsyncTransferEngine on SPI1.
+     * Holds the SPI transaction and chip select for the length of one frame, then releases both
+     * from the DMA complete event and hands control back to the engine, which starts the next frame from
+     * service() after the chip select HIGH hold, never from the interrupt.
+     * Only the 5 us chip select setup before a frame is still a busy wait, it is shorter than a scheduler tick.
+     */
+    class SPI1DMABackend
+    {
+    public:
+        /**
+         * Starts a DMA transfer and returns right away
+         * @param on_complete called once the frame is done and chip select is HIGH again (interrupt context, must not start SPI traffic)
+         * @return false if the SPI driver refused to start the DMA transfer
+         */
+        inline bool begin_transfer(int cs, const uint8_t *tx, uint8_t *rx, size_t length, void (*on_complete)(void *), void *context);
+
+        /**
+         * Sets chip select without waiting; the engine times the hold
+         */
+        inline void write_chip_select(int cs, bool level);
+
+        /**
+         * Clocks 2 dummy bytes at cs's SPI settings, the wakeup edge for the isoSPI port
+         */
+        inline void send_wake_clocks(int cs);
+
+    private:
+        static inline void _on_dma_complete(EventResponderRef event);
+
+        EventResponder _event;
+        int _cs = -1;
+        void (*_on_complete)(void *) = nullptr;
+        void *_context = nullptr;
+    };
+
     inline void _write_and_delay_low(int cs, int delay_microSeconds);
 }
 
@@ -1,23 +1,24 @@
 /* Interface Includes */
 #include "LTCSPIInterface.h"
 #include <Arduino.h>
+#include <algorithm>
 
-template <size_t data_size>
-void _transfer_SPI_data(const std::array<uint8_t, data_size> &data) {
-    for (size_t i = 0; i < data_size; i++) {
-        SPI1.transfer(data[i]);
+void ltc_spi_interface::set_spi_clock(int cs, uint32_t clock_hz) {
+    if (cs < 0 || cs > MAX_CHIP_SELECT_PIN) {
+        return;
     }
+    _spi_clock_hz_per_cs[cs] = std::min(clock_hz, DEFAULT_SPI_CLOCK_HZ);
 }
 
-template <size_t data_size>
-std::array<uint8_t, data_size> _receive_SPI_data() {
-    std::array<uint8_t, data_size> data_in;
-    for (size_t i = 0; i < data_size; i++) {
-
-        data_in[i] = SPI1.transfer(0);
+uint32_t ltc_spi_interface::get_spi_clock(int cs) {
+    if (cs < 0 || cs > MAX_CHIP_SELECT_PIN || _spi_clock_hz_per_cs[cs] == 0) {
+        return DEFAULT_SPI_CLOCK_HZ;
     }
-   
-    return data_in;
+    return _spi_clock_hz_per_cs[cs];
+}
+
+SPISettings ltc_spi_interface::_spi_settings(int cs) {
+    return SPISettings(get_spi_clock(cs), MSBFIRST, SPI_MODE3);
 }
 
 void ltc_spi_interface::_write_and_delay_low(int cs, int delay_microSeconds) {
@@ -32,13 +33,16 @@ void ltc_spi_interface::_write_and_delay_high(int cs, int delay_microSeconds) {
 
 template <size_t buffer_size>
 void ltc_spi_interface::write_registers_command(int cs, std::array<uint8_t, 4> cmd_and_pec, const std::array<uint8_t, buffer_size> &data) {
-    SPI1.beginTransaction(SPISettings(1000000, MSBFIRST, SPI_MODE3));
+    // One contiguous frame so the whole thing goes out in a single buffered transfer instead of byte by byte
+    std::array<uint8_t, 4 + buffer_size> tx_frame;
+    std::copy_n(cmd_and_pec.begin(), 4, tx_frame.begin());
+    std::copy_n(data.begin(), buffer_size, tx_frame.begin() + 4);
+
+    SPI1.beginTransaction(_spi_settings(cs));
     // Prompting SPI enable
     _write_and_delay_low(cs, 5);
 
-    _transfer_SPI_data<4>(cmd_and_pec);
-
-    _transfer_SPI_data<buffer_size>(data);
+    SPI1.transfer(tx_frame.data(), nullptr, tx_frame.size());
 
     _write_and_delay_high(cs, 5);   
     SPI1.endTransaction();
@@ -46,29 +50,84 @@ void ltc_spi_interface::write_registers_command(int cs, std::array<uint8_t, 4> c
 
 template <size_t buffer_size>
 std::array<uint8_t, buffer_size> ltc_spi_interface::read_registers_command(int cs, std::array<uint8_t, 4> cmd_and_pec) {
-    std::array<uint8_t, buffer_size> read_in;
-    
-    SPI1.beginTransaction(SPISettings(1000000, MSBFIRST, SPI_MODE3));
+    // CMD + PEC followed by zeros to clock the register data back, received into the same sized frame
+    std::array<uint8_t, 4 + buffer_size> tx_frame = {};
+    std::array<uint8_t, 4 + buffer_size> rx_frame;
+    std::copy_n(cmd_and_pec.begin(), 4, tx_frame.begin());
+
+    SPI1.beginTransaction(_spi_settings(cs));
     // Prompts SPI enable
     _write_and_delay_low(cs, 5);
-    _transfer_SPI_data<4>(cmd_and_pec);
 
-    read_in = _receive_SPI_data<buffer_size>();
+    SPI1.transfer(tx_frame.data(), rx_frame.data(), tx_frame.size());
     
     _write_and_delay_high(cs, 5); 
     SPI1.endTransaction();
+
+    std::array<uint8_t, buffer_size> read_in;
+    std::copy_n(rx_frame.begin() + 4, buffer_size, read_in.begin());
     return read_in;
 }
 
 void ltc_spi_interface::adc_conversion_command(int cs, std::array<uint8_t, 4> cmd_and_pec, size_t num_stacked_devices) {
-    SPI1.beginTransaction(SPISettings(1000000, MSBFIRST, SPI_MODE3));
+    SPI1.beginTransaction(_spi_settings(cs));
     // Prompting SPI enable
     _write_and_delay_low(cs, 5);
-    _transfer_SPI_data<4>(cmd_and_pec);
-    for (size_t i = 0; i < num_stacked_devices; i++) {
-        SPI1.transfer(0);
-    }
+    SPI1.transfer(cmd_and_pec.data(), nullptr, cmd_and_pec.size());
+    // A null TX buffer clocks out zeros
+    SPI1.transfer(nullptr, nullptr, num_stacked_devices);
     _write_and_delay_high(cs, 5);
     // End Messager
     SPI1.endTransaction();
 }
+
+bool ltc_spi_interface::poll_adc_status_command(int cs, std::array<uint8_t, 4> cmd_and_pec) {
+    SPI1.beginTransaction(_spi_settings(cs));
+    // Prompting SPI enable
+    _write_and_delay_low(cs, 5);
+    SPI1.transfer(cmd_and_pec.data(), nullptr, cmd_and_pec.size());
+    uint8_t status = SPI1.transfer(0);
+    _write_and_delay_high(cs, 5);
+    SPI1.endTransaction();
+    return status != 0;
+}
+
+bool ltc_spi_interface::SPI1DMABackend::begin_transfer(int cs, const uint8_t *tx, uint8_t *rx, size_t length, void (*on_complete)(void *), void *context) {
+    _cs = cs;
+    _on_complete = on_complete;
+    _context = context;
+    // Context is set per transfer so the backend can live anywhere (singleton, copied test instance, etc.)
+    _event.setContext(this);
+    _event.attachImmediate(&SPI1DMABackend::_on_dma_complete);
+    _event.clearEvent();
+
+    SPI1.beginTransaction(_spi_settings(cs));
+    // Prompting SPI enable
+    _write_and_delay_low(cs, 5);
+    if (!SPI1.transfer(tx, rx, length, _event)) {
+        _write_and_delay_high(cs, 5);
+        SPI1.endTransaction();
+        return false;
+    }
+    return true;
+}
+
+void ltc_spi_interface::SPI1DMABackend::write_chip_select(int cs, bool level) {
+    digitalWrite(cs, level ? HIGH : LOW);
+}
+
+void ltc_spi_interface::SPI1DMABackend::send_wake_clocks(int cs) {
+    SPI1.beginTransaction(_spi_settings(cs));
+    SPI1.transfer16(0);
+    SPI1.endTransaction();
+}
+
+void ltc_spi_interface::SPI1DMABackend::_on_dma_complete(EventResponderRef event) {
+    auto *backend = static_cast<SPI1DMABackend *>(event.getContext());
+    // Interrupt context, keep it short: the engine only records the completion, the next frame starts from service()
+    digitalWrite(backend->_cs, HIGH);
+    SPI1.endTransaction();
+    if (backend->_on_complete != nullptr) {
+        backend->_on_complete(backend->_context);
+    }
+}
@@ -0,0 +1,264 @@
+#ifndef LTC_SPI_TRANSFER_ENGINE_H
+#define LTC_SPI_TRANSFER_ENGINE_H
+
+#include <array>
+#include <cstdint>
+#include <stddef.h>
+#include <algorithm>
+
+namespace ltc_spi_interface
+{
+    constexpr const uint32_t FRAME_CS_HIGH_HOLD_US = 5; // chip select stays HIGH this long after a frame before the next step
+
+    enum class AsyncTransferState_e
+    {
+        IDLE = 0,  ///< Nothing in flight, steps may be queued
+        IN_FLIGHT, ///< Steps are being run
+        COMPLETE   ///< Every queued step finished, received bytes can be read until release()
+    };
+
+    enum class TransferStep_e : uint8_t
+    {
+        CS_LOW = 0,  ///< Pull chip select LOW
+        CS_HIGH,     ///< Release chip select
+        WAKE_CLOCKS, ///< Clock dummy bytes while chip select is LOW, the edge that wakes the isoSPI port
+        FRAME        ///< One CMD + PEC + payload frame, chip select is handled by the backend
+    };
+
+    /**
+     * One timed protocol step. The step after it may not run until hold_us after this one ran
+     * (for FRAME steps, hold_us after service() saw the frame complete).
+     */
+    struct TransferStep_s
+    {
+        TransferStep_e type;
+        int cs;
+        uint32_t hold_us;
+        size_t frame_index;
+    };
+
+    /**
+     * Non-blocking sequencer for the LTC6811 isoSPI protocol.
+     *
+     * Everything a register access needs (wakeup pulses, CMD + PEC, payload, chip select release) is queued
+     * up front as timed steps. Nothing in here ever waits: service() runs every step whose hold time has run
+     * out and returns, so it can be driven from a scheduler task or a timer instead of delayMicroseconds().
+     * Frames are handed to the backend, which calls back once the frame is done. The callback only records
+     * that, the next step (back to back frames included) is started by service() once chip select has been
+     * HIGH for FRAME_CS_HIGH_HOLD_US, so nothing but the completion itself runs in interrupt context. The
+     * caller polls get_state() in a later tick and decodes the data.
+     *
+     * The backend is anything with:
+     *   bool begin_transfer(int cs, const uint8_t *tx, uint8_t *rx, size_t length, void (*on_complete)(void *), void *context);
+     *   void write_chip_select(int cs, bool level);
+     *   void send_wake_clocks(int cs);
+     * begin_transfer must return false if it could not start, and otherwise call on_complete(context) exactly
+     * once after the last byte is clocked and chip select is released. On the Teensy that is SPI1DMABackend;
+     * the unit tests use a mock.
+     *
+     * @tparam frame_size bytes clocked per frame, 4 (CMD + PEC) + payload
+     * @tparam max_frames number of frames that can be queued per start()
+     * @tparam max_steps number of steps, frames included, that can be queued per start()
+     */
+    template <typename backend_t, size_t frame_size, size_t max_frames, size_t max_steps = max_frames>
+    class AsyncTransferEngine
+    {
+    public:
+        using Frame = std::array<uint8_t, frame_size>;
+
+        /**
+         * Queues one frame. Bytes after tx_length are clocked out as 0, which is what a register read needs.
+         * @return false if a transfer is in flight / not released yet, or the queue is full
+         */
+        bool queue_frame(int cs, const uint8_t *tx, size_t tx_length)
+        {
+            if (_state != AsyncTransferState_e::IDLE || _num_frames >= max_frames || _num_steps >= max_steps || tx_length > frame_size)
+            {
+                return false;
+            }
+            std::copy_n(tx, tx_length, _tx_frames[_num_frames].begin());
+            std::fill(_tx_frames[_num_frames].begin() + tx_length, _tx_frames[_num_frames].end(), 0);
+            _steps[_num_steps++] = {TransferStep_e::FRAME, cs, FRAME_CS_HIGH_HOLD_US, _num_frames};
+            _num_frames++;
+            return true;
+        }
+
+        /**
+         * Queues wakeup pulses: chip select LOW for pulse_us, dummy clocks, then chip select HIGH for pulse_us
+         * @return false if a transfer is in flight / not released yet, or the queue is full
+         */
+        bool queue_wakeup_pulses(int cs, size_t num_pulses, uint32_t pulse_us)
+        {
+            if (_state != AsyncTransferState_e::IDLE || _num_steps + (3 * num_pulses) > max_steps)
+            {
+                return false;
+            }
+            for (size_t pulse = 0; pulse < num_pulses; pulse++)
+            {
+                _steps[_num_steps++] = {TransferStep_e::CS_LOW, cs, pulse_us, 0};
+                _steps[_num_steps++] = {TransferStep_e::WAKE_CLOCKS, cs, 0, 0};
+                _steps[_num_steps++] = {TransferStep_e::CS_HIGH, cs, pulse_us, 0};
+            }
+            return true;
+        }
+
+        /**
+         * Runs the first step(s) and returns right away
+         * @return false if nothing is queued, a transfer is already running, or the backend refused the first frame
+         */
+        bool start(uint32_t now_us)
+        {
+            if (_state != AsyncTransferState_e::IDLE || _num_steps == 0)
+            {
+                return false;
+            }
+            _current_step = 0;
+            _num_completed_frames = 0;
+            _frame_in_flight = false;
+            _frame_done = false;
+            _transfer_refused = false;
+            _next_step_us = now_us;
+            _state = AsyncTransferState_e::IN_FLIGHT;
+            service(now_us);
+            if (_transfer_refused && _num_completed_frames == 0)
+            {
+                _state = AsyncTransferState_e::IDLE;
+                release();
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * Runs every step that is due. Cheap when nothing is due, so call it as often as possible.
+         */
+        void service(uint32_t now_us)
+        {
+            while (_state == AsyncTransferState_e::IN_FLIGHT && !_frame_in_flight && static_cast<int32_t>(now_us - _next_step_us) >= 0)
+            {
+                if (_frame_done)
+                {
+                    // Chip select went HIGH with the completion, the step after the frame waits out its hold from here
+                    _frame_done = false;
+                    _next_step_us = now_us + _steps[_current_step].hold_us;
+                    _current_step++;
+                    if (_current_step >= _num_steps)
+                    {
+                        _state = AsyncTransferState_e::COMPLETE;
+                        return;
+                    }
+                    continue;
+                }
+                if (_current_step >= _num_steps)
+                {
+                    _state = AsyncTransferState_e::COMPLETE;
+                    return;
+                }
+
+                const TransferStep_s &step = _steps[_current_step];
+                switch (step.type)
+                {
+                    case TransferStep_e::CS_LOW:
+                        _backend.write_chip_select(step.cs, false);
+                        break;
+                    case TransferStep_e::CS_HIGH:
+                        _backend.write_chip_select(step.cs, true);
+                        break;
+                    case TransferStep_e::WAKE_CLOCKS:
+                        _backend.send_wake_clocks(step.cs);
+                        break;
+                    case TransferStep_e::FRAME:
+                        // Whatever follows is run by a later service(), after the completion and the hold
+                        _begin_current_frame();
+                        return;
+                }
+                _next_step_us = now_us + step.hold_us;
+                _current_step++;
+            }
+        }
+
+        /**
+         * Drops the queued steps and received data so the engine can be used again
+         * @pre get_state() is not IN_FLIGHT
+         */
+        void release()
+        {
+            if (_state == AsyncTransferState_e::IN_FLIGHT)
+            {
+                return;
+            }
+            _num_frames = 0;
+            _num_steps = 0;
+            _current_step = 0;
+            _num_completed_frames = 0;
+            _state = AsyncTransferState_e::IDLE;
+        }
+
+        AsyncTransferState_e get_state() const { return _state; }
+
+        size_t get_num_frames() const { return _num_frames; }
+
+        size_t get_num_steps() const { return _num_steps; }
+
+        /**
+         * @return how many of the queued frames were actually clocked; less than get_num_frames() only if the
+         * backend refused to start one part way through
+         */
+        size_t get_num_completed_frames() const { return (_state == AsyncTransferState_e::COMPLETE) ? _num_completed_frames : 0; }
+
+        /**
+         * @return bytes received while frame_index was clocked, including the 4 bytes clocked during CMD + PEC
+         */
+        const Frame &get_received_frame(size_t frame_index) const { return _rx_frames[frame_index]; }
+
+        backend_t &get_backend() { return _backend; }
+
+    private:
+        /**
+         * Starts the FRAME step at _current_step. If the backend refuses, the transfer ends with whatever was received.
+         */
+        void _begin_current_frame()
+        {
+            const TransferStep_s &step = _steps[_current_step];
+            // Set before starting, the completion callback may fire before begin_transfer() returns
+            _frame_in_flight = true;
+            if (!_backend.begin_transfer(step.cs, _tx_frames[step.frame_index].data(), _rx_frames[step.frame_index].data(),
+                                         frame_size, &_on_frame_complete, this))
+            {
+                _frame_in_flight = false;
+                _transfer_refused = true;
+                _state = AsyncTransferState_e::COMPLETE;
+            }
+        }
+
+        /**
+         * Called by the backend (possibly from an interrupt) every time a frame finishes, hands the frame back to service()
+         */
+        static void _on_frame_complete(void *context)
+        {
+            auto *engine = static_cast<AsyncTransferEngine *>(context);
+            engine->_num_completed_frames++;
+            // Before clearing _frame_in_flight, service() checks them in the other order
+            engine->_frame_done = true;
+            engine->_frame_in_flight = false;
+        }
+
+        backend_t _backend = {};
+
+        std::array<TransferStep_s, max_steps> _steps = {};
+        std::array<Frame, max_frames> _tx_frames = {};
+        std::array<Frame, max_frames> _rx_frames = {};
+
+        size_t _num_frames = 0;
+        size_t _num_steps = 0;
+        volatile size_t _current_step = 0;
+        volatile size_t _num_completed_frames = 0;
+        volatile bool _frame_in_flight = false;
+        volatile bool _frame_done = false;
+        volatile bool _transfer_refused = false;
+        volatile uint32_t _next_step_us = 0;
+        volatile AsyncTransferState_e _state = AsyncTransferState_e::IDLE;
+    };
+}
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef MIN_MAX_TREE_H
+#define MIN_MAX_TREE_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stddef.h>
+#include <type_traits>
+
+/**
+ * Tournament tree over a fixed size array of values that always knows the exact minimum and maximum and where
+ * they are. Changing one value replays only the matches on its path to the root, O(log n), so the extremes stay
+ * exact no matter which values were updated when, and nothing ever needs a full rescan.
+ *
+ * Values start out (and can be taken back out) as absent, absent values never win. On ties the lower index wins.
+ *
+ * @tparam value_t type of the values, compared with < and >
+ * @tparam num_values number of values
+ */
+template <typename value_t, size_t num_values>
+class MinMaxTree
+{
+public:
+    static_assert(num_values > 0 && num_values < UINT16_MAX, "Indexes are stored as uint16_t");
+
+    using index_t = std::conditional_t<(num_values < UINT8_MAX), uint8_t, uint16_t>;
+    static constexpr index_t NO_INDEX = std::numeric_limits<index_t>::max();
+
+    MinMaxTree();
+
+    /**
+     * Sets the value at index and replays its path to the root
+     */
+    void update(size_t index, value_t value);
+
+    /**
+     * Takes the value at index out of the running until it is updated again
+     */
+    void remove(size_t index);
+
+    /**
+     * Takes every value out of the running
+     */
+    void clear();
+
+    /**
+     * @return true if no value is present
+     */
+    bool empty() const { return _min_winner[1] == NO_INDEX; }
+
+    bool contains(size_t index) const { return _present[index]; }
+
+    /**
+     * @pre !empty()
+     * @return index / value of the smallest and largest present values
+     */
+    size_t min_index() const { return _min_winner[1]; }
+    size_t max_index() const { return _max_winner[1]; }
+    value_t min_value() const { return _values[_min_winner[1]]; }
+    value_t max_value() const { return _values[_max_winner[1]]; }
+
+    value_t value(size_t index) const { return _values[index]; }
+
+private:
+    static constexpr size_t _num_leaves = [] {
+        size_t leaves = 1;
+        while (leaves < num_values)
+        {
+            leaves *= 2;
+        }
+        return leaves;
+    }();
+
+    /**
+     * Replays the matches from leaf position node up to the root
+     */
+    void _replay(size_t node);
+
+    index_t _min_of(index_t a, index_t b) const;
+    index_t _max_of(index_t a, index_t b) const;
+
+    std::array<value_t, num_values> _values = {};
+    std::array<bool, num_values> _present = {};
+    // Node 1 is the root, node n has children 2n and 2n + 1, value i is the leaf at _num_leaves + i
+    std::array<index_t, 2 * _num_leaves> _min_winner;
+    std::array<index_t, 2 * _num_leaves> _max_winner;
+};
+
+#include "MinMaxTree.tpp"
+
+#endif
@@ -0,0 +1,77 @@
+#include "MinMaxTree.h"
+
+template <typename value_t, size_t num_values>
+MinMaxTree<value_t, num_values>::MinMaxTree()
+{
+    clear();
+}
+
+template <typename value_t, size_t num_values>
+void MinMaxTree<value_t, num_values>::update(size_t index, value_t value)
+{
+    _values[index] = value;
+    _present[index] = true;
+    _min_winner[_num_leaves + index] = static_cast<index_t>(index);
+    _max_winner[_num_leaves + index] = static_cast<index_t>(index);
+    _replay(_num_leaves + index);
+}
+
+template <typename value_t, size_t num_values>
+void MinMaxTree<value_t, num_values>::remove(size_t index)
+{
+    if (!_present[index])
+    {
+        return;
+    }
+    _present[index] = false;
+    _min_winner[_num_leaves + index] = NO_INDEX;
+    _max_winner[_num_leaves + index] = NO_INDEX;
+    _replay(_num_leaves + index);
+}
+
+template <typename value_t, size_t num_values>
+void MinMaxTree<value_t, num_values>::clear()
+{
+    _present.fill(false);
+    _min_winner.fill(NO_INDEX);
+    _max_winner.fill(NO_INDEX);
+}
+
+template <typename value_t, size_t num_values>
+void MinMaxTree<value_t, num_values>::_replay(size_t node)
+{
+    for (node /= 2; node > 0; node /= 2)
+    {
+        _min_winner[node] = _min_of(_min_winner[2 * node], _min_winner[(2 * node) + 1]);
+        _max_winner[node] = _max_of(_max_winner[2 * node], _max_winner[(2 * node) + 1]);
+    }
+}
+
+template <typename value_t, size_t num_values>
+typename MinMaxTree<value_t, num_values>::index_t MinMaxTree<value_t, num_values>::_min_of(index_t a, index_t b) const
+{
+    // a always comes from the left (lower index) subtree, so it keeps ties
+    if (a == NO_INDEX)
+    {
+        return b;
+    }
+    if (b == NO_INDEX)
+    {
+        return a;
+    }
+    return (_values[b] < _values[a]) ? b : a;
+}
+
+template <typename value_t, size_t num_values>
+typename MinMaxTree<value_t, num_values>::index_t MinMaxTree<value_t, num_values>::_max_of(index_t a, index_t b) const
+{
+    if (a == NO_INDEX)
+    {
+        return b;
+    }
+    if (b == NO_INDEX)
+    {
+        return a;
+    }
+    return (_values[b] > _values[a]) ? b : a;
+}
@@ -10,6 +10,7 @@ void ACUEthernetInterface::init_ethernet_device() {
     Ethernet.begin(EthernetIPDefsInstance::instance().acu_ip, EthernetIPDefsInstance::instance().car_subnet, EthernetIPDefsInstance::instance().default_gateway);
     _acu_core_data_send_socket.begin(EthernetIPDefsInstance::instance().ACUCoreData_port);
     _acu_all_data_send_socket.begin(EthernetIPDefsInstance::instance().ACUAllData_port);
+    _bms_acquisition_data_send_socket.begin(acu_ethernet_params::BMS_ACQUISITION_DATA_PORT);
     _vcr_data_recv_socket.begin(EthernetIPDefsInstance::instance().VCRData_port);
     _db_data_recv_socket.begin(EthernetIPDefsInstance::instance().DBData_port);
 }
@@ -27,6 +28,13 @@ void ACUEthernetInterface::handle_send_ethernet_acu_core_data(const hytech_msgs_
                                                 &_acu_core_data_send_socket, data, hytech_msgs_ACUCoreData_fields);
 }
 
+void ACUEthernetInterface::handle_send_ethernet_bms_acquisition_data(const ACUBMSAcquisitionTelemetry_s &data) {
+    // Fixed layout, no protobuf schema to go through
+    _bms_acquisition_data_send_socket.beginPacket(EthernetIPDefsInstance::instance().drivebrain_ip, acu_ethernet_params::BMS_ACQUISITION_DATA_PORT);
+    _bms_acquisition_data_send_socket.write(reinterpret_cast<const uint8_t *>(&data), sizeof(data));
+    _bms_acquisition_data_send_socket.endPacket();
+}
+
 hytech_msgs_ACUCoreData ACUEthernetInterface::make_acu_core_data_msg(const ACUCoreData_s &shared_state)
 {
     hytech_msgs_ACUCoreData out;
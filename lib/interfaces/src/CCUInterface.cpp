@@ -37,19 +37,19 @@ void CCUInterface::handle_enqueue_acu_voltages_CAN_message() {
     BMS_DETAILED_VOLTAGES_t detailed_msg = {};
     detailed_msg.ic_id = static_cast<uint8_t>(_curr_data.detailed_voltages_ic_id);
     detailed_msg.group_id = static_cast<uint8_t>(_curr_data.detailed_voltages_group_id);
-    detailed_msg.voltage_0_ro = HYTECH_voltage_0_ro_toS(_acu_all_data.cell_voltages[_curr_data.detailed_voltages_cell_id]); 
-    detailed_msg.voltage_1_ro = HYTECH_voltage_1_ro_toS(_acu_all_data.cell_voltages[_curr_data.detailed_voltages_cell_id+1]); 
-    detailed_msg.voltage_2_ro = HYTECH_voltage_2_ro_toS(_acu_all_data.cell_voltages[_curr_data.detailed_voltages_cell_id+2]); 
+    // A group slot without a cell (chip with a cell count that is not a multiple of 3) is sent as 0 V
+    const auto &group_cells = ACUPackTopology::cv_group_cells[_curr_data.detailed_voltages_ic_id][_curr_data.detailed_voltages_group_id];
+    auto cell_voltage = [this](uint8_t cell) { return (cell == bms_pack_layout::NO_CELL) ? 0.0f : _acu_all_data.cell_voltages[cell]; };
+    detailed_msg.voltage_0_ro = HYTECH_voltage_0_ro_toS(cell_voltage(group_cells[0])); 
+    detailed_msg.voltage_1_ro = HYTECH_voltage_1_ro_toS(cell_voltage(group_cells[1])); 
+    detailed_msg.voltage_2_ro = HYTECH_voltage_2_ro_toS(cell_voltage(group_cells[2])); 
 
-    if (_curr_data.detailed_voltages_ic_id % 2 == 0) {
-        _curr_data.detailed_voltages_group_id = (_curr_data.detailed_voltages_group_id == 3) ? 0 : _curr_data.detailed_voltages_group_id+1;
-    } else {
-        _curr_data.detailed_voltages_group_id = (_curr_data.detailed_voltages_group_id == 2) ? 0 : _curr_data.detailed_voltages_group_id+1;
-    }
+    const size_t last_group_id = ACUPackTopology::chip_num_cv_groups[_curr_data.detailed_voltages_ic_id] - 1;
+    _curr_data.detailed_voltages_group_id = (_curr_data.detailed_voltages_group_id == last_group_id) ? 0 : _curr_data.detailed_voltages_group_id+1;
     if (_curr_data.detailed_voltages_group_id == 0) {
         _curr_data.detailed_voltages_ic_id = (_curr_data.detailed_voltages_ic_id == (ccu_interface_defaults::NUM_CHIPS - 1)) ? 0 : _curr_data.detailed_voltages_ic_id+1;
     }
-    _curr_data.detailed_voltages_cell_id = (_curr_data.detailed_voltages_cell_id == ccu_interface_defaults::NUM_CELLS - 3) ? 0 : _curr_data.detailed_voltages_cell_id+3;
+    _curr_data.detailed_voltages_cell_id = ACUPackTopology::cv_group_cells[_curr_data.detailed_voltages_ic_id][_curr_data.detailed_voltages_group_id][0];
     
     CAN_util::enqueue_msg(&detailed_msg, &Pack_BMS_DETAILED_VOLTAGES_hytech, ACUCANInterfaceImpl::ccu_can_tx_buffer);
 } 
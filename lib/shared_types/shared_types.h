@@ -1,6 +1,10 @@
 #ifndef SHAREDTYPES_H
 #define SHAREDTYPES_H
 
+#include <array>
+#include <cstdint>
+#include <stddef.h>
+
 #include "SharedFirmwareTypes.h"
 
 struct BMSCoreData_s {
@@ -10,6 +14,19 @@ struct BMSCoreData_s {
     celsius max_cell_temp; 
     celsius min_cell_temp; 
     celsius max_board_temp;
+    bool cell_ov_flagged; // LTC6811 OV comparator set on some cell, see BMSDriverGroup::read_cell_voltage_flags()
+    bool cell_uv_flagged; // LTC6811 UV comparator set on some cell
+};
+
+/**
+ * LTC6811 ADC modes (MD[1:0]) with ADCOPT = 0. FAST is 27 kHz, NORMAL 7 kHz, FILTERED 26 Hz (slowest, least noise)
+ */
+enum class ADC_MODE_e : uint8_t
+{
+    MODE_ZERO = 0x0,
+    FAST = 0x1,
+    NORMAL = 0x2,
+    FILTERED = 0x3
 };
 
 /**
@@ -63,5 +80,33 @@ enum ReadGroup_e {
     AUX_GROUP_A,   AUX_GROUP_B, NUM_GROUPS
 };
 
+constexpr const uint8_t BMS_ACQUISITION_TELEMETRY_VERSION = 3;
+
+/**
+ * BMS acquisition health, sent as its own UDP datagram next to ACUAllData (whose protobuf schema, like the CAN
+ * messages, is pinned outside this repo). The struct is the wire format: packed, little endian as on the Teensy.
+ * Bump BMS_ACQUISITION_TELEMETRY_VERSION whenever the layout changes.
+ *
+ * @tparam num_cells cells in the pack
+ * @tparam num_cell_temps cell thermistors in the pack
+ * @tparam num_chip_selects chip selects the BMS chips are split over
+ */
+template <size_t num_cells, size_t num_cell_temps, size_t num_chip_selects>
+struct __attribute__((packed)) BMSAcquisitionTelemetry_s
+{
+    uint8_t version = BMS_ACQUISITION_TELEMETRY_VERSION;
+    uint32_t sent_us = 0;                                   // micros() when the datagram was built
+    std::array<uint32_t, num_chip_selects> spi_clock_hz = {}; // SPI clock each chip select runs at, see BMSSPIClockController
+    std::array<float, num_chip_selects> pec_failure_rate = {}; // rolling fraction of packets failing PEC on each chip select
+    uint32_t acquisition_latency_min_us = 0;                     // conversion start to read, over the last complete window
+    uint32_t acquisition_latency_avg_us = 0;
+    uint32_t acquisition_latency_max_us = 0;
+    std::array<uint32_t, num_cells> cell_voltage_age_us = {};      // age of each published cell voltage at sent_us
+    std::array<uint32_t, num_cell_temps> cell_temperature_age_us = {}; // age of each published thermistor reading at sent_us
+    uint32_t sampling_period_us = 0;        // BMS read period currently asked for
+    float effective_sampling_rate_hz = 0.0f; // reads per second actually taken, the nominal rate with fixed sampling
+    uint8_t adc_mode = 0;                   // ADC_MODE_e the cell / GPIO conversions run in
+};
+
 
 #endif
\ No newline at end of file
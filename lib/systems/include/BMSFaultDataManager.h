@@ -5,7 +5,15 @@
 
 #include "BMSDriverGroup.h"  // for ValidPacketData_s
 
-template <size_t num_chips>
+namespace bms_fault_data_defaults
+{
+    constexpr const float PEC_FAILURE_RATE_SMOOTHING = 0.05f; // weight of the newest update in the rolling per chip select PEC failure rate
+}
+
+/**
+ * @tparam num_chip_selects chips are split evenly and in order over the chip selects, the same as BMSDriverGroup
+ */
+template <size_t num_chips, size_t num_chip_selects = 1>
 class BMSFaultDataManager
 {
 public:
@@ -23,9 +31,15 @@ public:
         float  valid_packet_rate = 0.0f;                              
         size_t max_consecutive_invalid_packet_count = 0;                   
         std::array<BMSFaultCountData_s, num_chips> chip_invalid_cmd_counts{};
+        std::array<float, num_chip_selects> pec_failure_rates{}; // rolling fraction of invalid packets on each chip select
     };
 
-    void update_from_valid_packets( const std::array<ValidPacketData_s, num_chips>& valid_read_packets);
+    /**
+     * @param read_groups bit per ReadGroup_e read since the last update (BMSDataSnapshot_s::read_groups). Only those
+     * groups count towards the PEC failure rates, the flags of the others are left over from earlier reads
+     */
+    void update_from_valid_packets(const std::array<ValidPacketData_s, num_chips>& valid_read_packets,
+                                   uint8_t read_groups = (1U << ReadGroup_e::NUM_GROUPS) - 1);
 
     const BMSFaultData_s& get_fault_data() const;
 
@@ -33,8 +47,8 @@ private:
     BMSFaultData_s _bms_fault_data{};
 };
 
-template <size_t num_chips>
-using BMSFaultDataManagerInstance = etl::singleton<BMSFaultDataManager<num_chips>>;
+template <size_t num_chips, size_t num_chip_selects = 1>
+using BMSFaultDataManagerInstance = etl::singleton<BMSFaultDataManager<num_chips, num_chip_selects>>;
 
 #include "BMSFaultDataManager.tpp"
 
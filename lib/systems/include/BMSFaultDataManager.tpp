@@ -1,14 +1,15 @@
 #include "BMSFaultDataManager.h"
 #include "etl/algorithm.h"
 
-template <size_t num_chips>
-void BMSFaultDataManager<num_chips>::update_from_valid_packets(
-    const std::array<ValidPacketData_s, num_chips>& valid_read_packets)
+template <size_t num_chips, size_t num_chip_selects>
+void BMSFaultDataManager<num_chips, num_chip_selects>::update_from_valid_packets(
+    const std::array<ValidPacketData_s, num_chips>& valid_read_packets, uint8_t read_groups)
 {
     size_t num_total_bms_packets = num_chips * sizeof(BMSFaultCountData_s);
     std::array<size_t, num_chips> chip_max_invalid_cmd_counts = {};
     std::array<size_t, sizeof(BMSFaultCountData_s)> temp = {};
     size_t num_valid_packets = 0;
+    std::array<size_t, num_chip_selects> num_invalid_packets_per_cs = {};
     
     for (size_t chip = 0; chip < valid_read_packets.size(); chip++)
     {
@@ -20,6 +21,16 @@ void BMSFaultDataManager<num_chips>::update_from_valid_packets(
         _bms_fault_data.chip_invalid_cmd_counts[chip].invalid_gpio_4_to_6_count = (!valid_read_packets[chip].valid_read_gpios_4_to_6) ? _bms_fault_data.chip_invalid_cmd_counts[chip].invalid_gpio_4_to_6_count+1 : 0;
         num_valid_packets += static_cast<size_t>(valid_read_packets[chip].valid_read_cells_1_to_3 + valid_read_packets[chip].valid_read_cells_4_to_6 + valid_read_packets[chip].valid_read_cells_7_to_9 + 
                               valid_read_packets[chip].valid_read_cells_10_to_12 + valid_read_packets[chip].valid_read_gpios_1_to_3 + valid_read_packets[chip].valid_read_gpios_4_to_6);
+        const std::array<bool, ReadGroup_e::NUM_GROUPS> group_valid = {valid_read_packets[chip].valid_read_cells_1_to_3, valid_read_packets[chip].valid_read_cells_4_to_6,
+                                                                        valid_read_packets[chip].valid_read_cells_7_to_9, valid_read_packets[chip].valid_read_cells_10_to_12,
+                                                                        valid_read_packets[chip].valid_read_gpios_1_to_3, valid_read_packets[chip].valid_read_gpios_4_to_6};
+        for (size_t group = 0; group < ReadGroup_e::NUM_GROUPS; group++)
+        {
+            if (((read_groups >> group) & 1U) && !group_valid[group])
+            {
+                num_invalid_packets_per_cs[BMSPackTopology<num_chips, num_chip_selects>::chip_cs[chip]]++;
+            }
+        }
 
         temp = {_bms_fault_data.chip_invalid_cmd_counts[chip].invalid_cell_1_to_3_count,
             _bms_fault_data.chip_invalid_cmd_counts[chip].invalid_cell_4_to_6_count,
@@ -31,12 +42,20 @@ void BMSFaultDataManager<num_chips>::update_from_valid_packets(
         _bms_fault_data.consecutive_invalid_packet_counts[chip] = chip_max_invalid_cmd_counts[chip];
     }
     _bms_fault_data.valid_packet_rate = static_cast<float>(static_cast<float>(num_valid_packets) / num_total_bms_packets);
+
+    // A failed group stays flagged until it is read again, so only the groups read since the last update count
+    const size_t num_packets_per_cs = (num_chips / num_chip_selects) * __builtin_popcount(read_groups);
+    for (size_t cs = 0; num_packets_per_cs != 0 && cs < num_chip_selects; cs++)
+    {
+        const float failure_rate = static_cast<float>(num_invalid_packets_per_cs[cs]) / num_packets_per_cs;
+        _bms_fault_data.pec_failure_rates[cs] += bms_fault_data_defaults::PEC_FAILURE_RATE_SMOOTHING * (failure_rate - _bms_fault_data.pec_failure_rates[cs]);
+    }
     _bms_fault_data.max_consecutive_invalid_packet_count = *etl::max_element(chip_max_invalid_cmd_counts.begin(), chip_max_invalid_cmd_counts.end()); 
 }
 
-template <size_t num_chips>
-const typename BMSFaultDataManager<num_chips>::BMSFaultData_s&
-BMSFaultDataManager<num_chips>::get_fault_data() const
+template <size_t num_chips, size_t num_chip_selects>
+const typename BMSFaultDataManager<num_chips, num_chip_selects>::BMSFaultData_s&
+BMSFaultDataManager<num_chips, num_chip_selects>::get_fault_data() const
 {
     return _bms_fault_data;
 }
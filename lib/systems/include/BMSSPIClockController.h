@@ -0,0 +1,79 @@
+#ifndef BMS_SPI_CLOCK_CONTROLLER_H
+#define BMS_SPI_CLOCK_CONTROLLER_H
+
+#include <array>
+#include <cstdint>
+#include <stddef.h>
+
+#include <etl/singleton.h>
+
+namespace bms_spi_clock_defaults
+{
+    // Clock ladder the controller steps along. The top is the isoSPI limit, which is also what the bus always ran at
+    constexpr const std::array<uint32_t, 4> CLOCK_STEPS_HZ = {125000, 250000, 500000, 1000000};
+    constexpr const float STEP_DOWN_FAILURE_RATE = 0.05f;  // slow a chip select down above this rolling PEC failure rate
+    constexpr const float STEP_UP_FAILURE_RATE = 0.005f;   // speed it back up below this one
+    constexpr const uint32_t UPDATES_BEFORE_STEP_DOWN = 20; // updates at one clock before it may drop again, lets the rolling rate see the new clock
+    constexpr const uint32_t UPDATES_BEFORE_STEP_UP = 300;  // updates at one clock before it may rise again, so a noisy segment does not oscillate
+}
+
+struct BMSSPIClockControllerConfig_s
+{
+    float step_down_failure_rate;
+    float step_up_failure_rate;
+    uint32_t updates_before_step_down;
+    uint32_t updates_before_step_up;
+};
+
+/**
+ * Picks an isoSPI clock for every chip select from its rolling PEC failure rate (BMSFaultDataManager).
+ *
+ * Every chip select starts at the top of the clock ladder. A chip select with a failure rate above
+ * step_down_failure_rate drops one step, and one that stayed below step_up_failure_rate climbs back one step.
+ * Both are held off for a number of updates after every change (hysteresis), longer for going up than down.
+ * This only decides the clocks; applying them to the bus is up to the caller.
+ */
+template <size_t num_chip_selects>
+class BMSSPIClockController
+{
+public:
+    BMSSPIClockController(const BMSSPIClockControllerConfig_s &config = {
+                              .step_down_failure_rate = bms_spi_clock_defaults::STEP_DOWN_FAILURE_RATE,
+                              .step_up_failure_rate = bms_spi_clock_defaults::STEP_UP_FAILURE_RATE,
+                              .updates_before_step_down = bms_spi_clock_defaults::UPDATES_BEFORE_STEP_DOWN,
+                              .updates_before_step_up = bms_spi_clock_defaults::UPDATES_BEFORE_STEP_UP});
+
+    /**
+     * Steps each chip select's clock from its latest rolling PEC failure rate, call once per BMS read
+     * @return true if any chip select's clock changed
+     */
+    bool update(const std::array<float, num_chip_selects> &pec_failure_rates);
+
+    /**
+     * @return the clock chip select cs should run at
+     */
+    uint32_t get_clock_hz(size_t cs) const;
+
+    /**
+     * @return how many times each chip select's clock was lowered / raised since startup
+     */
+    uint32_t get_step_down_count(size_t cs) const { return _step_down_counts[cs]; }
+    uint32_t get_step_up_count(size_t cs) const { return _step_up_counts[cs]; }
+
+private:
+    static constexpr size_t _top_step = bms_spi_clock_defaults::CLOCK_STEPS_HZ.size() - 1;
+
+    const BMSSPIClockControllerConfig_s _config;
+
+    std::array<size_t, num_chip_selects> _clock_steps;
+    std::array<uint32_t, num_chip_selects> _updates_since_change = {};
+    std::array<uint32_t, num_chip_selects> _step_down_counts = {};
+    std::array<uint32_t, num_chip_selects> _step_up_counts = {};
+};
+
+template <size_t num_chip_selects>
+using BMSSPIClockControllerInstance = etl::singleton<BMSSPIClockController<num_chip_selects>>;
+
+#include "BMSSPIClockController.tpp"
+
+#endif
@@ -0,0 +1,43 @@
+#include "BMSSPIClockController.h"
+
+template <size_t num_chip_selects>
+BMSSPIClockController<num_chip_selects>::BMSSPIClockController(const BMSSPIClockControllerConfig_s &config) : _config(config)
+{
+    _clock_steps.fill(_top_step);
+}
+
+template <size_t num_chip_selects>
+bool BMSSPIClockController<num_chip_selects>::update(const std::array<float, num_chip_selects> &pec_failure_rates)
+{
+    bool clock_changed = false;
+    for (size_t cs = 0; cs < num_chip_selects; cs++)
+    {
+        _updates_since_change[cs]++;
+
+        if (pec_failure_rates[cs] > _config.step_down_failure_rate && _clock_steps[cs] > 0 &&
+            _updates_since_change[cs] >= _config.updates_before_step_down)
+        {
+            _clock_steps[cs]--;
+            _step_down_counts[cs]++;
+        }
+        else if (pec_failure_rates[cs] < _config.step_up_failure_rate && _clock_steps[cs] < _top_step &&
+                 _updates_since_change[cs] >= _config.updates_before_step_up)
+        {
+            _clock_steps[cs]++;
+            _step_up_counts[cs]++;
+        }
+        else
+        {
+            continue;
+        }
+        _updates_since_change[cs] = 0;
+        clock_changed = true;
+    }
+    return clock_changed;
+}
+
+template <size_t num_chip_selects>
+uint32_t BMSSPIClockController<num_chip_selects>::get_clock_hz(size_t cs) const
+{
+    return bms_spi_clock_defaults::CLOCK_STEPS_HZ[_clock_steps[cs]];
+}
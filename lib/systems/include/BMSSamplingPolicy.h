@@ -0,0 +1,94 @@
+#ifndef BMS_SAMPLING_POLICY_H
+#define BMS_SAMPLING_POLICY_H
+
+#include <cstdint>
+#include <stddef.h>
+
+#include <etl/singleton.h>
+
+#include "SharedFirmwareTypes.h"
+#include "shared_types.h"
+
+namespace bms_sampling_policy_defaults
+{
+    constexpr const uint32_t SLOW_PERIOD_US = 250000;   // 4 Hz, longer than a FILTERED conversion (~200 ms) so no read waits on one
+    constexpr const uint32_t NORMAL_PERIOD_US = 100000; // 10 Hz, what the BMS always sampled at
+    constexpr const uint32_t FAST_PERIOD_US = 10000;    // 100 Hz, a full frame every 60 ms
+    constexpr const float CHARGING_FAST_MARGIN_V = 0.05f;     // charge with fast sampling once the highest cell is this close to OV
+    constexpr const float CHARGING_FAST_HYSTERESIS_V = 0.02f; // and go back to normal only once it is this much further away again
+    constexpr const ADC_MODE_e SLOW_ADC_MODE = ADC_MODE_e::FILTERED;
+}
+
+struct BMSSamplingPolicyConfig_s
+{
+    uint32_t slow_period_us;
+    uint32_t normal_period_us;
+    uint32_t fast_period_us;
+    ADC_MODE_e slow_adc_mode; // FILTERED unless the caller waits out conversions in a blocking delay
+    volt cell_overvoltage_thresh_v;
+    volt charging_fast_margin_v;
+    volt charging_fast_hysteresis_v;
+};
+
+enum class BMSSamplingRate_e
+{
+    SLOW = 0, // STARTUP / FAULTED: nothing to react to, lowest noise
+    NORMAL,   // everything else
+    FAST      // ACTIVE, and CHARGING close to OV
+};
+
+struct BMSSampling_s
+{
+    BMSSamplingRate_e rate;
+    uint32_t period_us;
+    ADC_MODE_e adc_mode;
+};
+
+/**
+ * Picks how often the BMS is sampled and with which ADC mode from the ACU state.
+ *
+ * STARTUP / FAULTED sample slowly in slow_adc_mode (FILTERED by default), ACTIVE samples fast in FAST mode. CHARGING samples at the normal
+ * rate in NORMAL mode, and fast in FAST mode once the highest cell comes within charging_fast_margin_v of OV (with
+ * hysteresis). The sampling task runs at the fast period and asks sample_due() whether to read this tick.
+ * This only decides; applying the ADC mode to the driver is up to the caller.
+ */
+class BMSSamplingPolicy
+{
+public:
+    BMSSamplingPolicy(const BMSSamplingPolicyConfig_s &config);
+
+    /**
+     * Picks the sampling for the current ACU state and highest cell voltage, call every tick
+     * @return true if the sampling changed
+     */
+    bool update(ACUState_e state, volt max_cell_voltage);
+
+    /**
+     * @return true if a sample should be taken at now_us under the current period, which is then counted as taken
+     */
+    bool sample_due(uint32_t now_us);
+
+    const BMSSampling_s &get_sampling() const { return _sampling; }
+
+    /**
+     * @return samples per second actually taken since the sampling last changed, 0 until two samples were taken
+     */
+    float get_effective_rate_hz() const;
+
+private:
+    BMSSampling_s _select_sampling(ACUState_e state, volt max_cell_voltage);
+
+    const BMSSamplingPolicyConfig_s _config;
+
+    BMSSampling_s _sampling;
+    bool _charging_near_ov = false;
+
+    bool _sampled_once = false;
+    uint32_t _last_sample_us = 0;
+    uint32_t _first_sample_us = 0;   // of the current sampling
+    uint32_t _samples_at_sampling = 0;
+};
+
+using BMSSamplingPolicyInstance = etl::singleton<BMSSamplingPolicy>;
+
+#endif
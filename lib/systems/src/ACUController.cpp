@@ -1,4 +1,5 @@
 #include "ACUController.h"
+#include <algorithm>
 
 
 void ACUController::init(time_ms system_start_time, volt pack_voltage)
@@ -57,7 +58,10 @@ ACUControllerData_s ACUController::evaluate_accumulator(time_ms current_millis,
         // Only calculate IR compensation when approaching OV threshold
         internal_resistance_max_cell_voltage = input_state.max_cell_voltage + (_acu_parameters.pack_specs.pack_internal_resistance / static_cast<float>(num_of_voltage_cells) * discharge_current);
     }
-    if (internal_resistance_max_cell_voltage < _acu_parameters.thresholds.cell_overvoltage_thresh_v || has_invalid_packet)
+    // A hardware comparator flag is a violation on its own: the chip compared the cell against VOV itself, even if the
+    // group holding it hasn't been read back yet. No IR compensation, and no invalid packet excuse, it has its own PEC
+    const bool measured_ov = internal_resistance_max_cell_voltage >= _acu_parameters.thresholds.cell_overvoltage_thresh_v && !has_invalid_packet;
+    if (!measured_ov && !input_state.cell_ov_flagged)
     {
         _acu_state.last_time_ov_fault_not_present = current_millis;
     }
@@ -69,7 +73,9 @@ ACUControllerData_s ACUController::evaluate_accumulator(time_ms current_millis,
         // Only calculate IR compensation when approaching UV threshold
         min_cell_voltage_to_check = input_state.min_cell_voltage + (_acu_parameters.pack_specs.pack_internal_resistance / static_cast<float>(num_of_voltage_cells) * discharge_current);
     }
-    if (min_cell_voltage_to_check > _acu_parameters.thresholds.cell_undervoltage_thresh_v || has_invalid_packet)
+    // Same for the UV comparator (VUV in CFGR)
+    const bool measured_uv = min_cell_voltage_to_check <= _acu_parameters.thresholds.cell_undervoltage_thresh_v && !has_invalid_packet;
+    if (!measured_uv && !input_state.cell_uv_flagged)
     {
         _acu_state.last_time_uv_fault_not_present = current_millis;
     }
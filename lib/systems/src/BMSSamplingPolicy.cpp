@@ -0,0 +1,81 @@
+#include "BMSSamplingPolicy.h"
+
+BMSSamplingPolicy::BMSSamplingPolicy(const BMSSamplingPolicyConfig_s &config) : _config(config)
+{
+    _sampling = _select_sampling(ACUState_e::STARTUP, 0);
+}
+
+bool BMSSamplingPolicy::update(ACUState_e state, volt max_cell_voltage)
+{
+    const BMSSampling_s sampling = _select_sampling(state, max_cell_voltage);
+    if (sampling.rate == _sampling.rate && sampling.adc_mode == _sampling.adc_mode)
+    {
+        return false;
+    }
+    _sampling = sampling;
+    _samples_at_sampling = 0;
+    return true;
+}
+
+bool BMSSamplingPolicy::sample_due(uint32_t now_us)
+{
+    // The task ticks at the fast period, half a tick of slack keeps its jitter from pushing a sample a whole tick late
+    if (_sampled_once && (now_us - _last_sample_us) + (_config.fast_period_us / 2) < _sampling.period_us)
+    {
+        return false;
+    }
+
+    if (_samples_at_sampling == 0)
+    {
+        _first_sample_us = now_us;
+    }
+    _samples_at_sampling++;
+    _last_sample_us = now_us;
+    _sampled_once = true;
+    return true;
+}
+
+float BMSSamplingPolicy::get_effective_rate_hz() const
+{
+    if (_samples_at_sampling < 2 || _last_sample_us == _first_sample_us)
+    {
+        return 0.0f;
+    }
+    return static_cast<float>(_samples_at_sampling - 1) * 1000000.0f / static_cast<float>(_last_sample_us - _first_sample_us);
+}
+
+BMSSampling_s BMSSamplingPolicy::_select_sampling(ACUState_e state, volt max_cell_voltage)
+{
+    const BMSSampling_s slow = {BMSSamplingRate_e::SLOW, _config.slow_period_us, _config.slow_adc_mode};
+    const BMSSampling_s normal = {BMSSamplingRate_e::NORMAL, _config.normal_period_us, ADC_MODE_e::NORMAL};
+    const BMSSampling_s fast = {BMSSamplingRate_e::FAST, _config.fast_period_us, ADC_MODE_e::FAST};
+
+    if (state != ACUState_e::CHARGING)
+    {
+        _charging_near_ov = false;
+    }
+
+    switch (state)
+    {
+        case ACUState_e::STARTUP:
+        case ACUState_e::FAULTED:
+            return slow;
+        case ACUState_e::ACTIVE:
+            return fast;
+        case ACUState_e::CHARGING:
+        {
+            const volt fast_above_v = _config.cell_overvoltage_thresh_v - _config.charging_fast_margin_v;
+            if (max_cell_voltage >= fast_above_v)
+            {
+                _charging_near_ov = true;
+            }
+            else if (max_cell_voltage < fast_above_v - _config.charging_fast_hysteresis_v)
+            {
+                _charging_near_ov = false;
+            }
+            return _charging_near_ov ? fast : normal;
+        }
+        default:
+            return normal;
+    }
+}
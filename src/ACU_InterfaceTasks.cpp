@@ -2,23 +2,43 @@
 
 const auto start_time = std::chrono::high_resolution_clock::now();
 
+// Longest gap between watchdog kicks since the last debug print, shows how much blocking tasks delay the rest
+static unsigned long last_watchdog_kick_us = 0;
+static unsigned long max_watchdog_kick_interval_us = 0;
+
+// Start of the last sum of cells conversion sample_bms_data ran, it blocks for the ADSTAT so it isn't run every sample
+static unsigned long last_sum_of_cells_us = 0;
+
+// Burst reads, sum of cells and diagnostics wait out their conversions in delayMicroseconds. A FILTERED conversion
+// (~200 ms, ~34 ms for ADSTAT) there would hold off the watchdog kick, so slow sampling stays in NORMAL mode with them
+static constexpr bool BMS_WAITS_ON_CONVERSIONS = ACUConstants::USE_BURST_BMS_ACQUISITION ||
+                                                 ACUConstants::USE_BMS_SUM_OF_CELLS ||
+                                                 ACUConstants::USE_BMS_DIAGNOSTICS;
+static constexpr ADC_MODE_e BMS_SLOW_ADC_MODE = BMS_WAITS_ON_CONVERSIONS ? ADC_MODE_e::NORMAL
+                                                                         : bms_sampling_policy_defaults::SLOW_ADC_MODE;
+static_assert(!BMS_WAITS_ON_CONVERSIONS ||
+                  (bms_driver_defaults::ADC_MODE_CV_CONVERSION != static_cast<uint8_t>(ADC_MODE_e::FILTERED) &&
+                   bms_driver_defaults::ADC_MODE_GPIO_CONVERSION != static_cast<uint8_t>(ADC_MODE_e::FILTERED)),
+              "FILTERED conversions are too long to wait out in a blocking delay");
+
 // Helper: assemble ACUAllDataType_s from BMS driver data and watchdog getWatchDogData
 static ACUAllDataType_s make_acu_all_data()
 {
     ACUAllDataType_s out{};
 
-    auto bms = BMSDriverInstance_t::instance().get_bms_data();
+    const auto &bms = BMSDriverInstance_t::instance().get_bms_data();
     auto fault_data = BMSFaultDataManagerInstance_t::instance().get_fault_data();
-    // Copy per-cell data
-    std::copy(bms.voltages.begin(), bms.voltages.end(), out.cell_voltages.begin());
-    std::copy(bms.cell_temperatures.begin(), bms.cell_temperatures.end(), out.cell_temps.begin());
-    std::copy(bms.board_temperatures.begin(), bms.board_temperatures.end(), out.board_temps.begin());
+    // Convert per-cell data, the driver only keeps the raw codes
+    bms.convert_voltages(out.cell_voltages.data());
+    bms.convert_cell_temperatures(out.cell_temps.data());
+    bms.convert_board_temperatures(out.board_temps.data());
 
     // Core data from BMS
     out.core_data.avg_cell_voltage = bms.avg_cell_voltage;
     out.core_data.max_cell_voltage = bms.max_cell_voltage;
     out.core_data.min_cell_voltage = bms.min_cell_voltage;
-    out.core_data.pack_voltage = bms.total_voltage;
+    // Same pack voltage the controller runs on: the sum of cells when it is read, the cell total otherwise
+    out.core_data.pack_voltage = BMSDriverInstance_t::instance().get_bms_core_data().pack_voltage;
     out.core_data.max_cell_temp = bms.max_cell_temp;
     out.core_data.min_cell_temp = bms.min_cell_temp;
     out.core_data.max_board_temp = bms.max_board_temp;
@@ -60,6 +80,48 @@ static ACUAllDataType_s make_acu_all_data()
     return out;
 }
 
+// Helper: assemble the BMS acquisition health datagram, the parts of it ACUAllData has no fields for
+static ACUBMSAcquisitionTelemetry_s make_bms_acquisition_telemetry()
+{
+    ACUBMSAcquisitionTelemetry_s out{};
+    out.sent_us = micros();
+
+    const auto &pec_failure_rates = BMSFaultDataManagerInstance_t::instance().get_fault_data().pec_failure_rates;
+    for (size_t cs = 0; cs < ACUConstants::NUM_CHIP_SELECTS; cs++)
+    {
+        out.spi_clock_hz[cs] = BMSDriverInstance_t::instance().get_spi_clock(cs);
+        out.pec_failure_rate[cs] = pec_failure_rates[cs];
+    }
+
+    const auto &acquisition_stats = BMSDriverInstance_t::instance().get_acquisition_latency_stats();
+    out.acquisition_latency_min_us = acquisition_stats.window_min_latency_us;
+    out.acquisition_latency_avg_us = acquisition_stats.window_avg_latency_us;
+    out.acquisition_latency_max_us = acquisition_stats.window_max_latency_us;
+    for (size_t cell = 0; cell < ACUConstants::NUM_CELLS; cell++)
+    {
+        out.cell_voltage_age_us[cell] = BMSDriverInstance_t::instance().get_cell_voltage_age_us(cell, out.sent_us);
+    }
+    for (size_t thermistor = 0; thermistor < ACUConstants::NUM_CELL_TEMPS; thermistor++)
+    {
+        out.cell_temperature_age_us[thermistor] = BMSDriverInstance_t::instance().get_cell_temperature_age_us(thermistor, out.sent_us);
+    }
+
+    if constexpr (ACUConstants::USE_ADAPTIVE_BMS_SAMPLING)
+    {
+        const BMSSamplingPolicy &sampling_policy = BMSSamplingPolicyInstance::instance();
+        out.sampling_period_us = sampling_policy.get_sampling().period_us;
+        out.effective_sampling_rate_hz = sampling_policy.get_effective_rate_hz();
+    }
+    else
+    {
+        out.sampling_period_us = ACUConstants::SAMPLE_BMS_PERIOD_US;
+        out.effective_sampling_rate_hz = 1000000.0f / ACUConstants::SAMPLE_BMS_PERIOD_US;
+    }
+    out.adc_mode = static_cast<uint8_t>(BMSDriverInstance_t::instance().get_adc_mode());
+
+    return out;
+}
+
 void initialize_all_interfaces()
 {
     SPI.begin();
@@ -87,11 +149,33 @@ void initialize_all_interfaces()
     /* BMS Driver */
     BMSDriverInstance_t::create(ACUConstants::CS, ACUConstants::CS_PER_CHIP, ACUConstants::ADDR);
     BMSDriverInstance_t::instance().init();
-    /* Get Initial Pack Voltage for SoC and SoH Approximations */
-    auto data = BMSDriverInstance_t::instance().read_data();
+    /* Get Initial Pack Voltage for SoC and SoH Approximations, burst so every cell is read at least once */
+    BMSDriverInstance_t::instance().set_acquisition_mode(AcquisitionMode_e::BURST);
+    const auto &data = BMSDriverInstance_t::instance().read_data();
+    BMSDriverInstance_t::instance().set_acquisition_mode(ACUConstants::USE_BURST_BMS_ACQUISITION    ? AcquisitionMode_e::BURST
+                                                         : ACUConstants::USE_WEIGHTED_BMS_SCHEDULING ? AcquisitionMode_e::WEIGHTED
+                                                                                                     : AcquisitionMode_e::ROUND_ROBIN);
+    if constexpr (ACUConstants::USE_BMS_SUM_OF_CELLS)
+    {
+        BMSDriverInstance_t::instance().read_sum_of_cells();
+    }
 
     BMSFaultDataManagerInstance_t::create();
     BMSFaultDataManagerInstance_t::instance().update_from_valid_packets(data.valid_read_packets);
+    BMSSPIClockControllerInstance_t::create();
+    BMSSamplingPolicyInstance::create(BMSSamplingPolicyConfig_s{
+        .slow_period_us = bms_sampling_policy_defaults::SLOW_PERIOD_US,
+        .normal_period_us = bms_sampling_policy_defaults::NORMAL_PERIOD_US,
+        .fast_period_us = ACUConstants::SAMPLE_BMS_PERIOD_US,
+        .slow_adc_mode = BMS_SLOW_ADC_MODE,
+        .cell_overvoltage_thresh_v = ACUSystems::CELL_OVERVOLTAGE_THRESH,
+        .charging_fast_margin_v = bms_sampling_policy_defaults::CHARGING_FAST_MARGIN_V,
+        .charging_fast_hysteresis_v = bms_sampling_policy_defaults::CHARGING_FAST_HYSTERESIS_V});
+    if constexpr (ACUConstants::USE_ADAPTIVE_BMS_SAMPLING)
+    {
+        /* The policy only reports changes, so the startup sampling has to be applied here */
+        BMSDriverInstance_t::instance().set_adc_mode(BMSSamplingPolicyInstance::instance().get_sampling().adc_mode);
+    }
     /* Ethernet Interface */
     ACUEthernetInterfaceInstance::create();
     ACUEthernetInterfaceInstance::instance().init_ethernet_device();
@@ -210,23 +294,120 @@ void initialize_all_interfaces()
 
 HT_TASK::TaskResponse run_kick_watchdog(const unsigned long &sysMicros, const HT_TASK::TaskInfo &taskInfo)
 {
+    if (last_watchdog_kick_us != 0)
+    {
+        max_watchdog_kick_interval_us = std::max(max_watchdog_kick_interval_us, sysMicros - last_watchdog_kick_us);
+    }
+    last_watchdog_kick_us = sysMicros;
+
     WatchdogInstance::instance().update_watchdog_state(sys_time::hal_millis());
     return HT_TASK::TaskResponse::YIELD;
 }
 
+// Feeds the latest per chip select PEC failure rates to the clock controller and applies any clock it changed
+static void update_bms_spi_clocks()
+{
+    if constexpr (ACUConstants::USE_ADAPTIVE_BMS_SPI_CLOCK)
+    {
+        if (BMSSPIClockControllerInstance_t::instance().update(BMSFaultDataManagerInstance_t::instance().get_fault_data().pec_failure_rates))
+        {
+            for (size_t cs = 0; cs < ACUConstants::NUM_CHIP_SELECTS; cs++)
+            {
+                BMSDriverInstance_t::instance().set_spi_clock(cs, BMSSPIClockControllerInstance_t::instance().get_clock_hz(cs));
+            }
+        }
+    }
+}
+
+// Feeds a newly published BMS read to the packet statistics, a call that decoded nothing is not counted again
+static void update_bms_fault_data()
+{
+    static uint32_t last_bms_sequence = 0;
+    const auto &snapshot = BMSDriverInstance_t::instance().get_bms_snapshot();
+    if (snapshot.sequence == last_bms_sequence)
+    {
+        return;
+    }
+    last_bms_sequence = snapshot.sequence;
+    BMSFaultDataManagerInstance_t::instance().update_from_valid_packets(snapshot.data.valid_read_packets, snapshot.read_groups);
+    update_bms_spi_clocks();
+}
+
 HT_TASK::TaskResponse sample_bms_data(const unsigned long &sysMicros, const HT_TASK::TaskInfo &taskInfo)
 {
-    auto data = BMSDriverInstance_t::instance().read_data();
-    BMSFaultDataManagerInstance_t::instance().update_from_valid_packets(data.valid_read_packets);
-    // print_bms_data(data);
+    if constexpr (ACUConstants::USE_ADAPTIVE_BMS_SAMPLING)
+    {
+        BMSSamplingPolicy &sampling_policy = BMSSamplingPolicyInstance::instance();
+        if (sampling_policy.update(ACUStateMachineInstance::instance().get_state(), BMSDriverInstance_t::instance().get_bms_data().max_cell_voltage))
+        {
+            // The driver holds the new mode back until the next frame starts converting
+            BMSDriverInstance_t::instance().set_adc_mode(sampling_policy.get_sampling().adc_mode);
+        }
+        if (!sampling_policy.sample_due(sysMicros))
+        {
+            return HT_TASK::TaskResponse::YIELD;
+        }
+    }
+    if constexpr (ACUConstants::USE_BMS_SUM_OF_CELLS)
+    {
+        // Ahead of the read, so the conversions it starts don't hold the ADSTAT up. With async reads, only once
+        // the transfer in flight is done. The pack UV check doesn't need it any faster than SUM_OF_CELLS_PERIOD_US
+        const bool sum_of_cells_due = (sysMicros - last_sum_of_cells_us) >= ACUConstants::SUM_OF_CELLS_PERIOD_US;
+        if (sum_of_cells_due && (!ACUConstants::USE_ASYNC_BMS_READ || BMSDriverInstance_t::instance().is_async_read_complete()))
+        {
+            BMSDriverInstance_t::instance().read_sum_of_cells();
+            last_sum_of_cells_us = sysMicros;
+        }
+    }
+    if constexpr (ACUConstants::USE_ASYNC_BMS_READ)
+    {
+        if (BMSDriverInstance_t::instance().is_async_read_complete())
+        {
+            BMSDriverInstance_t::instance().finish_read_data_async();
+            // Between transfers, so the blocking status read never waits on the DMA
+            if constexpr (ACUConstants::USE_BMS_OV_UV_FAST_PATH)
+            {
+                BMSDriverInstance_t::instance().read_cell_voltage_flags();
+            }
+        }
+        BMSDriverInstance_t::instance().start_read_data_async();
+    }
+    else
+    {
+        BMSDriverInstance_t::instance().read_data();
+        if constexpr (ACUConstants::USE_BMS_OV_UV_FAST_PATH)
+        {
+            BMSDriverInstance_t::instance().read_cell_voltage_flags();
+        }
+        if constexpr (ACUConstants::USE_BMS_DIAGNOSTICS)
+        {
+            // Right after the read, in what is left of this tick, so it never pushes the next sample back
+            const uint32_t tick_elapsed_us = micros() - sysMicros;
+            if (tick_elapsed_us < ACUConstants::SAMPLE_BMS_PERIOD_US)
+            {
+                BMSDriverInstance_t::instance().run_diagnostics_slot(ACUConstants::SAMPLE_BMS_PERIOD_US - tick_elapsed_us);
+            }
+        }
+    }
+    update_bms_fault_data();
+    // print_bms_data(BMSDriverInstance_t::instance().get_bms_data());
 
     return HT_TASK::TaskResponse::YIELD;
 }
 
+HT_TASK::TaskResponse service_bms_read(const unsigned long &sysMicros, const HT_TASK::TaskInfo &taskInfo)
+{
+    BMSDriverInstance_t::instance().service_async_read();
+    return HT_TASK::TaskResponse::YIELD;
+}
+
 std::array<bool, ACUConstants::NUM_CELLS> check_and_get_balancing_status() {
     std::array<bool, ACUConstants::NUM_CELLS> cell_balancing_statuses = {false};
     if(ACUControllerInstance::instance().get_status().balancing_enabled) {
-        ACUControllerInstance::instance().calculate_cell_balance_statuses(cell_balancing_statuses.data(), BMSDriverInstance_t::instance().get_bms_data().voltages.data(), ACUConstants::NUM_CELLS, BMSDriverInstance_t::instance().get_bms_data().min_cell_voltage);
+        const auto &bms_data = BMSDriverInstance_t::instance().get_bms_data();
+        std::array<volt, ACUConstants::NUM_CELLS> cell_voltages;
+        bms_data.convert_voltages(cell_voltages.data());
+        ACUControllerInstance::instance().calculate_cell_balance_statuses(cell_balancing_statuses.data(), cell_voltages.data(), ACUConstants::NUM_CELLS, bms_data.min_cell_voltage);
     }
     return cell_balancing_statuses;
 }
@@ -257,6 +438,7 @@ HT_TASK::TaskResponse handle_send_ACU_all_ethernet_data(const unsigned long &sys
     auto send_data = make_acu_all_data();
 
     ACUEthernetInterfaceInstance::instance().handle_send_ethernet_acu_all_data(ACUEthernetInterfaceInstance::instance().make_acu_all_data_msg(send_data));
+    ACUEthernetInterfaceInstance::instance().handle_send_ethernet_bms_acquisition_data(make_bms_acquisition_telemetry());
 
     // reset local extrema after sending a report period
     WatchdogMetricsInstance::instance().reset_metrics(
@@ -339,7 +521,7 @@ HT_TASK::TaskResponse idle_sample_interfaces(const unsigned long& sysMicros, con
 }
 /* Print Functions */
 template <typename bms_data>
-void print_bms_data(bms_data data)
+void print_bms_data(const bms_data &data)
 {
     Serial.print("Total Voltage: ");
     Serial.print(data.total_voltage, 4);
@@ -361,8 +543,9 @@ void print_bms_data(bms_data data)
     Serial.println();
 
     size_t chip_index = 1;
-    for (auto chip_voltages : data.voltages)
+    for (uint16_t chip_voltage_code : data.voltage_codes)
     {
+        volt chip_voltages = chip_voltage_code * bms_driver_defaults::CV_ADC_LSB_VOLTAGE;
         Serial.print("Cell ");
         Serial.print (chip_index); Serial.print(" ");
         if (chip_voltages)
@@ -379,9 +562,9 @@ void print_bms_data(bms_data data)
     }
     Serial.println();
 
-    int cti = 0;
-    for (auto temp : data.cell_temperatures)
+    for (size_t cti = 0; cti < data.cell_temperature_codes.size(); cti++)
     {
+        celsius temp = data.cell_temperature(cti);
         Serial.print("temp id ");
         Serial.print(cti);
         Serial.print(" val ");
@@ -389,7 +572,6 @@ void print_bms_data(bms_data data)
         Serial.print("\t");
         if (cti % 4 == 3)
             Serial.println();
-        cti++;
     }
     Serial.println();
 
@@ -473,20 +655,107 @@ HT_TASK::TaskResponse debug_print(const unsigned long &sysMicros, const HT_TASK:
 
     Serial.println();
 
+    const auto &bms_snapshot = BMSDriverInstance_t::instance().get_bms_snapshot();
+    Serial.printf("BMS Snapshot: %lu\tPublished %lu us ago\n", bms_snapshot.sequence, micros() - bms_snapshot.published_us);
+
     Serial.print("Pack Voltage: ");
-    Serial.println(BMSDriverInstance_t::instance().get_bms_data().total_voltage, 4);
+    Serial.println(bms_snapshot.data.total_voltage, 4);
 
     Serial.print("Minimum Cell Voltage: ");
-    Serial.println(BMSDriverInstance_t::instance().get_bms_data().min_cell_voltage, 4);
+    Serial.println(bms_snapshot.data.min_cell_voltage, 4);
 
     Serial.print("Maximum Cell Voltage: ");
-    Serial.println(BMSDriverInstance_t::instance().get_bms_data().max_cell_voltage, 4);
+    Serial.println(bms_snapshot.data.max_cell_voltage, 4);
 
     Serial.print("Maximum Board Temp: ");
-    Serial.println(BMSDriverInstance_t::instance().get_bms_data().max_board_temp, 4);
+    Serial.println(bms_snapshot.data.max_board_temp, 4);
 
     Serial.print("Maximum Cell Temp: ");
-    Serial.println(BMSDriverInstance_t::instance().get_bms_data().max_cell_temp, 4);
+    Serial.println(bms_snapshot.data.max_cell_temp, 4);
+
+    const auto &wakeup_stats = BMSDriverInstance_t::instance().get_wakeup_stats();
+    Serial.printf("BMS Wakeups Full: %lu\tisoSPI: %lu\tSkipped: %lu\n", wakeup_stats.full_wakeups_sent, wakeup_stats.isospi_wakeups_sent, wakeup_stats.wakeups_skipped);
+    const auto &config_write_stats = BMSDriverInstance_t::instance().get_config_write_stats();
+    Serial.printf("BMS Config Writes Sent: %lu\tSkipped: %lu\tVerified: %lu\tVerify Failures: %lu\tRefreshes Avoided: %lu\n", config_write_stats.config_writes_sent, config_write_stats.config_writes_skipped,
+                  config_write_stats.config_verifications, config_write_stats.config_verification_failures, config_write_stats.refresh_writes_avoided);
+    const auto &pec_failure_rates = BMSFaultDataManagerInstance_t::instance().get_fault_data().pec_failure_rates;
+    for (size_t cs = 0; cs < ACUConstants::NUM_CHIP_SELECTS; cs++)
+    {
+        Serial.printf("BMS CS %u SPI Clock (Hz): %lu\tPEC Failure Rate: %.4f\tSteps Down: %lu\tSteps Up: %lu\n", cs, BMSDriverInstance_t::instance().get_spi_clock(cs), pec_failure_rates[cs],
+                      BMSSPIClockControllerInstance_t::instance().get_step_down_count(cs), BMSSPIClockControllerInstance_t::instance().get_step_up_count(cs));
+    }
+    const auto &pec_retry_stats = BMSDriverInstance_t::instance().get_pec_retry_stats();
+    const uint32_t pec_failed_chips = pec_retry_stats.chips_recovered + pec_retry_stats.chips_not_recovered;
+    Serial.printf("BMS PEC Retries Sent: %lu\tChips Recovered: %lu / %lu (%.1f%%)\tOut Of Budget: %lu\n", pec_retry_stats.retries_sent, pec_retry_stats.chips_recovered, pec_failed_chips,
+                  (pec_failed_chips > 0) ? (100.0f * pec_retry_stats.chips_recovered / pec_failed_chips) : 0.0f, pec_retry_stats.retries_out_of_budget);
+    const auto &conversion_stats = BMSDriverInstance_t::instance().get_conversion_latency_stats();
+    if (conversion_stats.conversions_completed > 0)
+    {
+        Serial.printf("BMS ADC Conversion Latency (us) Last: %lu\tMin: %lu\tMax: %lu\tNot Ready Polls: %lu\tTimeouts: %lu\n", conversion_stats.last_latency_us, conversion_stats.min_latency_us, conversion_stats.max_latency_us, conversion_stats.polls_not_ready, conversion_stats.conversion_timeouts);
+    }
+    const auto &acquisition_stats = BMSDriverInstance_t::instance().get_acquisition_latency_stats();
+    if (acquisition_stats.windows_completed > 0)
+    {
+        Serial.printf("BMS Acquisition Latency (us) Last: %lu\tMin: %lu\tAvg: %lu\tMax: %lu\n", acquisition_stats.last_latency_us, acquisition_stats.window_min_latency_us, acquisition_stats.window_avg_latency_us, acquisition_stats.window_max_latency_us);
+    }
+    const uint32_t now_us = micros();
+    uint32_t oldest_cell_voltage_age_us = 0;
+    for (size_t cell = 0; cell < ACUConstants::NUM_CELLS; cell++)
+    {
+        oldest_cell_voltage_age_us = std::max(oldest_cell_voltage_age_us, BMSDriverInstance_t::instance().get_cell_voltage_age_us(cell, now_us));
+    }
+    Serial.printf("BMS Oldest Cell Voltage (us): %lu\n", oldest_cell_voltage_age_us);
+    if constexpr (ACUConstants::USE_WEIGHTED_BMS_SCHEDULING && !ACUConstants::USE_BURST_BMS_ACQUISITION)
+    {
+        const auto &visit_stats = BMSDriverInstance_t::instance().get_group_visit_stats();
+        Serial.printf("BMS Group Visits: %lu\tStaleness Forced: %lu\n", visit_stats.total_visits, visit_stats.staleness_visits);
+        for (size_t group = 0; group < ReadGroup_e::NUM_GROUPS; group++)
+        {
+            Serial.printf("BMS Group %u Visit Frequency: %.3f\tMax Reads Between Visits: %u\n", group, BMSDriverInstance_t::instance().get_group_visit_frequency(static_cast<ReadGroup_e>(group)),
+                          visit_stats.max_reads_between_visits[group]);
+        }
+    }
+    if constexpr (ACUConstants::USE_ADAPTIVE_BMS_SAMPLING)
+    {
+        const BMSSamplingPolicy &sampling_policy = BMSSamplingPolicyInstance::instance();
+        Serial.printf("BMS Sampling Rate: %d\tPeriod (us): %lu\tADC Mode: %d (Active %d)\tEffective Rate (Hz): %.2f\n", static_cast<int>(sampling_policy.get_sampling().rate), sampling_policy.get_sampling().period_us,
+                      static_cast<int>(sampling_policy.get_sampling().adc_mode), static_cast<int>(BMSDriverInstance_t::instance().get_adc_mode()), sampling_policy.get_effective_rate_hz());
+    }
+    if constexpr (ACUConstants::USE_BMS_DIAGNOSTICS && !ACUConstants::USE_ASYNC_BMS_READ)
+    {
+        const auto &diagnostics_stats = BMSDriverInstance_t::instance().get_diagnostics_stats();
+        Serial.printf("BMS Diagnostics Runs Open Wire: %lu\tMux: %lu\tSC Cross Check: %lu\tDeferred: %lu\tBus Time (us): %llu\n", diagnostics_stats.runs[0], diagnostics_stats.runs[1],
+                      diagnostics_stats.runs[2], diagnostics_stats.slots_deferred, diagnostics_stats.bus_time_used_us);
+        const auto &diagnostics = BMSDriverInstance_t::instance().get_diagnostics_data();
+        for (size_t chip = 0; chip < ACUConstants::NUM_CHIPS; chip++)
+        {
+            if (diagnostics.open_wires[chip] != 0 || diagnostics.mux_fail[chip] || diagnostics.thermal_shutdown[chip] || diagnostics.sc_mismatch[chip])
+            {
+                Serial.printf("BMS Chip %u Open Wires: 0x%04X\tMux Fail: %d\tThermal Shutdown: %d\tSC - Cells (V): %.3f\n", chip, diagnostics.open_wires[chip], diagnostics.mux_fail[chip],
+                              diagnostics.thermal_shutdown[chip], diagnostics.sc_minus_cells_v[chip]);
+            }
+        }
+    }
+    if constexpr (ACUConstants::USE_BMS_SUM_OF_CELLS)
+    {
+        const auto &sum_of_cells = BMSDriverInstance_t::instance().get_sum_of_cells_data();
+        const volt pack_voltage_sense = ADCInterfaceInstance::instance().read_pack_voltage_sense();
+        Serial.printf("BMS Sum Of Cells (V): %.3f\tAll Valid: %d\tCell Total: %.3f\tPack Sense: %.3f\tSum - Sense: %.3f\n", sum_of_cells.pack_voltage(), sum_of_cells.all_valid(),
+                      bms_snapshot.data.total_voltage, pack_voltage_sense, sum_of_cells.pack_voltage() - pack_voltage_sense);
+    }
+    if constexpr (ACUConstants::USE_BMS_OV_UV_FAST_PATH)
+    {
+        const auto &cell_voltage_flags = BMSDriverInstance_t::instance().get_cell_voltage_flags();
+        for (size_t chip = 0; chip < ACUConstants::NUM_CHIPS; chip++)
+        {
+            if (cell_voltage_flags.over_voltage[chip] != 0 || cell_voltage_flags.under_voltage[chip] != 0 || !cell_voltage_flags.valid[chip])
+            {
+                Serial.printf("BMS Chip %u Comparator OV: 0x%03X\tUV: 0x%03X\tValid: %d\n", chip, cell_voltage_flags.over_voltage[chip], cell_voltage_flags.under_voltage[chip], cell_voltage_flags.valid[chip]);
+            }
+        }
+    }
+    Serial.printf("Max Watchdog Kick Interval (us): %lu\n", max_watchdog_kick_interval_us);
+    max_watchdog_kick_interval_us = 0;
 
     // Serial.printf("Cell Balance Statuses: %d\n", ACUControllerInstance::instance().calculate_cell_balance_statuses());
 
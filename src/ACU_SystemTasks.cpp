@@ -13,7 +13,8 @@ bool initialize_all_systems()
                                                                 ACUSystems::BALANCE_TEMP_LIMIT_C,
                                                                 ACUSystems::BALANCE_ENABLE_TEMP_THRESH_C,
                                                                 ACUSystems::TS_ISOLATION_VOLTAGE} );
-    ACUControllerInstance::instance().init(sys_time::hal_millis(), BMSDriverInstance_t::instance().get_bms_data().total_voltage);
+    // Sum of cells if initialize_all_interfaces() measured it, otherwise the cell total of the burst read
+    ACUControllerInstance::instance().init(sys_time::hal_millis(), BMSDriverInstance_t::instance().get_bms_core_data().pack_voltage);
     /* State Machine Initialization */
 
     /* Delegate Function Definitions */
@@ -24,6 +24,7 @@ HT_SCHED::Scheduler& scheduler = HT_SCHED::Scheduler::getInstance();
 ::HT_TASK::Task tick_state_machine_task(HT_TASK::DUMMY_FUNCTION, tick_state_machine, ACUConstants::TICK_SM_PRIORITY, ACUConstants::TICK_SM_PERIOD_US);
 ::HT_TASK::Task kick_watchdog_task(HT_TASK::DUMMY_FUNCTION, run_kick_watchdog, ACUConstants::WATCHDOG_PRIORITY, ACUConstants::KICK_WATCHDOG_PERIOD_US); 
 ::HT_TASK::Task sample_bms_data_task(HT_TASK::DUMMY_FUNCTION, sample_bms_data, ACUConstants::SAMPLE_BMS_PRIORITY, ACUConstants::SAMPLE_BMS_PERIOD_US);
+::HT_TASK::Task service_bms_read_task(HT_TASK::DUMMY_FUNCTION, service_bms_read, ACUConstants::SERVICE_BMS_READ_PRIORITY, ACUConstants::SERVICE_BMS_READ_PERIOD_US);
 ::HT_TASK::Task eval_accumulator_task(HT_TASK::DUMMY_FUNCTION, evaluate_accumulator, ACUConstants::EVAL_ACC_PRIORITY, ACUConstants::EVAL_ACC_PERIOD_US);
 ::HT_TASK::Task write_cell_balancing_config_task(HT_TASK::DUMMY_FUNCTION, write_cell_balancing_config, ACUConstants::WRITE_CELL_BALANCE_PRIORITY, ACUConstants::WRITE_CELL_BALANCE_PERIOD_US);
 ::HT_TASK::Task send_all_data_ethernet_task(HT_TASK::DUMMY_FUNCTION, handle_send_ACU_all_ethernet_data, ACUConstants::ALL_DATA_ETHERNET_PRIORITY, ACUConstants::ALL_DATA_ETHERNET_PERIOD_US);
@@ -53,6 +54,10 @@ void setup()
     scheduler.schedule(tick_state_machine_task);
     scheduler.schedule(kick_watchdog_task);
     scheduler.schedule(sample_bms_data_task);
+    if constexpr (ACUConstants::USE_ASYNC_BMS_READ)
+    {
+        scheduler.schedule(service_bms_read_task);
+    }
     scheduler.schedule(eval_accumulator_task);
     scheduler.schedule(write_cell_balancing_config_task);
 
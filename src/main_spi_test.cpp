@@ -7,6 +7,7 @@
 /* Interface Includes */
 #include <Arduino.h>
 #include "BMSDriverGroup.h"
+#include "LTCCommandFrames.h"
 #include "WatchdogInterface.h"
 // #include "ACUEthernetInterface.h"
 
@@ -25,14 +26,12 @@ using chip_type = LTC6811_Type_e;
 
 const size_t sample_period_ms = 3; // 300 Hz - reads one group per call
 const uint32_t spi_baudrate = 115200;
-const uint8_t num_cells_per_board = 21;
 
 const size_t spi1_mosi_pin = 26;
 const size_t spi1_sck_pin = 27;
 const size_t spi1_miso_pin = 39;
 
 // Initialize chip_select, chip_select_per_chip, and address
-const constexpr int num_cells_per_chip = 21;
 const constexpr int num_groups = 6;
 const constexpr int num_chips = 12; 
 const constexpr int num_chip_selects = 2;
@@ -54,11 +53,66 @@ struct ReadGroupStats {
 };
 
 std::array<ReadGroupStats, num_groups> group_stats;
+
+// Frame-level transfer benchmark: the register group just read by the driver is read again on one chip select,
+// once clocked byte by byte (how ltc_spi_interface used to do it) and once as a single buffered transfer
+std::array<ReadGroupStats, num_groups> bytewise_transfer_stats;
+std::array<ReadGroupStats, num_groups> bulk_transfer_stats;
+constexpr size_t group_data_size = 8 * (num_chips / num_chip_selects);
+constexpr ltc_command_frames::CommandFrameTable_s command_frames = ltc_command_frames::make_command_frame_table(ltc_command_frames::make_pec15_table(bms_driver_defaults::CRC15_POLY), 0, 0);
 uint32_t cycle_count = 0;
 bool cycle_complete = false;
 
+void record_duration(ReadGroupStats &stats, uint32_t duration_us)
+{
+    stats.read_count++;
+    stats.total_duration_us += duration_us;
+    if (duration_us < stats.min_duration_us) {
+        stats.min_duration_us = duration_us;
+    }
+    if (duration_us > stats.max_duration_us) {
+        stats.max_duration_us = duration_us;
+    }
+}
+
+std::array<uint8_t, group_data_size> read_group_bytewise(int chip_select, const std::array<uint8_t, 4> &cmd_and_pec)
+{
+    std::array<uint8_t, group_data_size> data_in;
+    SPI1.beginTransaction(SPISettings(1000000, MSBFIRST, SPI_MODE3));
+    digitalWrite(chip_select, LOW);
+    delayMicroseconds(5);
+    for (uint8_t cmd_byte : cmd_and_pec) {
+        SPI1.transfer(cmd_byte);
+    }
+    for (size_t i = 0; i < group_data_size; i++) {
+        data_in[i] = SPI1.transfer(0);
+    }
+    digitalWrite(chip_select, HIGH);
+    delayMicroseconds(5);
+    SPI1.endTransaction();
+    return data_in;
+}
+
+void benchmark_group_transfer(ReadGroup_e group)
+{
+    const std::array<uint8_t, 4> &cmd_and_pec = command_frames.read_group[group];
+
+    // The driver just talked to the chips, so the isoSPI ports are still awake for both reads
+    elapsedMicros transfer_timer = 0;
+    auto bytewise_data = read_group_bytewise(cs[0], cmd_and_pec);
+    record_duration(bytewise_transfer_stats[group], transfer_timer);
+
+    transfer_timer = 0;
+    auto bulk_data = ltc_spi_interface::read_registers_command<group_data_size>(cs[0], cmd_and_pec);
+    record_duration(bulk_transfer_stats[group], transfer_timer);
+
+    if (bytewise_data != bulk_data) {
+        Serial.println("*** WARNING: Bytewise and bulk transfers read different data! ***");
+    }
+}
+
 template <typename driver_data>
-void print_voltages(driver_data data, uint32_t read_duration_us, ReadGroup_e current_group)
+void print_voltages(const driver_data &data, uint32_t read_duration_us, ReadGroup_e current_group)
 {
     Serial.println("========================================");
     Serial.print("Read Group: ");
@@ -101,7 +155,7 @@ void print_voltages(driver_data data, uint32_t read_duration_us, ReadGroup_e cur
     Serial.println(data.max_cell_voltage_id);
 
     Serial.print("Average Voltage: ");
-    Serial.print(data.total_voltage / ((num_chips / 2) * num_cells_per_board), 4);
+    Serial.print(data.total_voltage / BMSPackTopology<num_chips, num_chip_selects>::num_cells, 4);
     Serial.println("V");
 
     // BUG TEST: Check for division by zero in temperature calculation
@@ -133,42 +187,42 @@ void print_voltages(driver_data data, uint32_t read_duration_us, ReadGroup_e cur
     
     Serial.println();
 
-    for(int i=0; i< num_cells_per_chip * num_chips / 2; i++) 
+    using Topology = BMSPackTopology<num_chips, num_chip_selects>;
+    for (size_t chip = 0; chip < num_chips; chip++)
     {
-        if(i%num_cells_per_chip==0){
-            Serial.println();
-            Serial.print("Chip ");
-            Serial.println(i/num_cells_per_chip);
+        Serial.println();
+        Serial.print("Chip ");
+        Serial.println(chip);
+        for (size_t cell = Topology::chip_first_cell[chip]; cell < Topology::chip_first_cell[chip] + Topology::chip_num_cells[chip]; cell++)
+        {
+            Serial.print(data.voltage(cell));
+            Serial.print("\t");
         }
-        Serial.print(data.voltages[i]);
-        Serial.print("\t");
     }
     Serial.println();
     Serial.println();
 
-    int cti = 0;
-    for(auto temp : data.cell_temperatures)
+    for(size_t cti = 0; cti < data.cell_temperature_codes.size(); cti++)
     {
+        celsius temp = data.cell_temperature(cti);
         Serial.print("temp id ");
         Serial.print(cti);
         Serial.print(" val \t");
         Serial.print(temp);
         Serial.print("\t");
         if (cti % 4 == 3) Serial.println();
-        cti++;
     }
     Serial.println();
 
-    int temp_index = 0;
-    for(auto bt : data.board_temperatures)
+    for(size_t temp_index = 0; temp_index < data.board_temperature_codes.size(); temp_index++)
     {
+        celsius bt = data.board_temperature(temp_index);
         Serial.print("board temp id ");
         Serial.print(temp_index);
         Serial.print(" val ");
         Serial.print(bt);
         Serial.print("\t");
         if (temp_index % 4 == 3) Serial.println();
-        temp_index++;
     }
     Serial.println();
     Serial.println();
@@ -292,6 +346,14 @@ void print_performance_stats() {
         } else {
             Serial.println(" (no data)");
         }
+
+        if (bulk_transfer_stats[i].read_count > 0) {
+            Serial.print("  Frame transfer avg, bytewise: ");
+            Serial.print(bytewise_transfer_stats[i].total_duration_us / bytewise_transfer_stats[i].read_count);
+            Serial.print("us | bulk: ");
+            Serial.print(bulk_transfer_stats[i].total_duration_us / bulk_transfer_stats[i].read_count);
+            Serial.println("us");
+        }
     }
 
     Serial.println();
@@ -342,20 +404,14 @@ void loop()
         read_timer = 0;
 
         // Read one group from the BMS Driver
-        auto bms_data = BMSGroup.read_data();
+        const auto &bms_data = BMSGroup.read_data();
 
         // Capture read duration
         uint32_t read_duration_us = read_timer;
 
         // Update statistics for the group that was just read
-        group_stats[group_index].read_count++;
-        group_stats[group_index].total_duration_us += read_duration_us;
-        if (read_duration_us < group_stats[group_index].min_duration_us) {
-            group_stats[group_index].min_duration_us = read_duration_us;
-        }
-        if (read_duration_us > group_stats[group_index].max_duration_us) {
-            group_stats[group_index].max_duration_us = read_duration_us;
-        }
+        record_duration(group_stats[group_index], read_duration_us);
+        benchmark_group_transfer(group_before_read);
 
         // Detect cycle completion: we just read AUX_B and driver advanced back to GROUP_A
         cycle_complete = (group_before_read == ReadGroup_e::AUX_GROUP_B);
@@ -2,7 +2,17 @@
 #include "gmock/gmock.h"
 #include "test_systems/test_acu_controller.h"
 #include "test_systems/test_acu_state_machine.h"
+#include "test_systems/test_bms_spi_clock_controller.h"
+#include "test_systems/test_bms_sampling_policy.h"
 // #include "test_interfaces/test_adc_interface.h"
+#include "test_interfaces/test_ltc_command_frames.h"
+#include "test_interfaces/test_ltc_spi_transfer_engine.h"
+#include "test_interfaces/test_ltc_pec_validation.h"
+#include "test_interfaces/test_bms_pack_topology.h"
+#include "test_interfaces/test_gpio_temperature_lut.h"
+#include "test_interfaces/test_min_max_tree.h"
+#include "test_interfaces/test_group_read_scheduler.h"
+#include "test_interfaces/test_diagnostics_slot_scheduler.h"
 
 int main(int argc, char **argv) {
     testing::InitGoogleMock(&argc, argv);
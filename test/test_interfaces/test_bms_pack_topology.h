@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+#include <array>
+#include <stddef.h>
+
+#include "BMSPackTopology.h"
+
+using TestPackTopology = BMSPackTopology<12, 2>;
+
+static_assert(TestPackTopology::num_cells == 126, "6 segments x 21 cells");
+static_assert(TestPackTopology::num_cell_temps == 48, "4 thermistors per chip");
+static_assert(TestPackTopology::chips_per_cs == 6, "6 chips per chip select");
+static_assert(!TestPackTopology::chip_has_cv_group(1, 3) && TestPackTopology::chip_has_cv_group(0, 3), "group D only on 12 cell chips");
+
+TEST(BMSPackTopologyTesting, tables_match_the_index_arithmetic_they_replace)
+{
+    for (size_t chip = 0; chip < 12; chip++)
+    {
+        const size_t cells_per_chip = (chip % 2 == 0) ? 12 : 9;
+        ASSERT_EQ(TestPackTopology::chip_num_cells[chip], cells_per_chip);
+        ASSERT_EQ(TestPackTopology::chip_first_cell[chip], (chip / 2) * 21 + (chip % 2) * 12);
+        ASSERT_EQ(TestPackTopology::chip_cs[chip], chip / 6);
+
+        for (size_t group = 0; group < bms_pack_layout::NUM_CV_GROUPS; group++)
+        {
+            for (size_t slot = 0; slot < bms_pack_layout::CELLS_PER_CV_GROUP; slot++)
+            {
+                const size_t cell_on_chip = (3 * group) + slot;
+                const uint8_t expected = (cell_on_chip < cells_per_chip) ? static_cast<uint8_t>((chip / 2) * 21 + (chip % 2) * 12 + cell_on_chip) : bms_pack_layout::NO_CELL;
+                ASSERT_EQ(TestPackTopology::cv_group_cells[chip][group][slot], expected);
+            }
+        }
+        for (size_t gpio = 0; gpio < bms_pack_layout::THERMISTORS_PER_CHIP; gpio++)
+        {
+            ASSERT_EQ(TestPackTopology::thermistor_index[chip][gpio], chip * 4 + gpio);
+            ASSERT_EQ(TestPackTopology::thermistor_chip[chip * 4 + gpio], chip);
+            ASSERT_EQ(TestPackTopology::thermistor_aux_group[chip * 4 + gpio], (gpio < 3) ? 0 : 1);
+        }
+    }
+    ASSERT_EQ(TestPackTopology::cs_first_chip[0], 0);
+    ASSERT_EQ(TestPackTopology::cs_first_chip[1], 6);
+}
+
+TEST(BMSPackTopologyTesting, every_cell_appears_exactly_once)
+{
+    // Odd layout on purpose: 10 / 8 cells leave partially filled CV groups
+    using OddTopology = BMSPackTopology<4, 1, 10, 8>;
+    std::array<int, OddTopology::num_cells> seen{};
+    for (size_t chip = 0; chip < 4; chip++)
+    {
+        for (const auto &group : OddTopology::cv_group_cells[chip])
+        {
+            for (uint8_t cell : group)
+            {
+                if (cell != bms_pack_layout::NO_CELL)
+                {
+                    ASSERT_LT(cell, OddTopology::num_cells);
+                    seen[cell]++;
+                }
+            }
+        }
+    }
+    for (int count : seen)
+    {
+        ASSERT_EQ(count, 1);
+    }
+    ASSERT_EQ(OddTopology::num_cells, 36U);
+}
+
+TEST(BMSPackTopologyTesting, cell_lookups_invert_cv_group_cells)
+{
+    using OddTopology = BMSPackTopology<4, 1, 10, 8>;
+    for (size_t chip = 0; chip < 4; chip++)
+    {
+        for (size_t group = 0; group < bms_pack_layout::NUM_CV_GROUPS; group++)
+        {
+            for (uint8_t cell : OddTopology::cv_group_cells[chip][group])
+            {
+                if (cell != bms_pack_layout::NO_CELL)
+                {
+                    ASSERT_EQ(OddTopology::cell_chip[cell], chip);
+                    ASSERT_EQ(OddTopology::cell_cv_group[cell], group);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#include "gtest/gtest.h"
+#include <array>
+#include <stddef.h>
+
+#include "DiagnosticsSlotScheduler.h"
+
+TEST(DiagnosticsSlotSchedulerTesting, diagnostics_wait_for_budget_and_take_turns)
+{
+    // 10 ms per second, every diagnostic expected to take 4 ms
+    DiagnosticsSlotScheduler scheduler(10000, {4000, 4000, 4000});
+    ASSERT_EQ(scheduler.next(0), BMSDiagnostic_e::NUM_DIAGNOSTICS); // starts with an empty bucket
+    ASSERT_EQ(scheduler.next(300000), BMSDiagnostic_e::NUM_DIAGNOSTICS); // 3 ms earned
+    ASSERT_EQ(scheduler.next(400000), BMSDiagnostic_e::OPEN_WIRE);
+    scheduler.record_run(BMSDiagnostic_e::OPEN_WIRE, 4000);
+    ASSERT_EQ(scheduler.get_available_us(), 0);
+
+    ASSERT_EQ(scheduler.next(800000), BMSDiagnostic_e::MUX_SELF_TEST);
+    scheduler.record_run(BMSDiagnostic_e::MUX_SELF_TEST, 1000); // shorter than expected, and expected that short from now on
+    ASSERT_EQ(scheduler.next(850000), BMSDiagnostic_e::NUM_DIAGNOSTICS); // 3.5 ms left
+    ASSERT_EQ(scheduler.next(900000), BMSDiagnostic_e::CELL_SC_CROSS_CHECK);
+    scheduler.record_run(BMSDiagnostic_e::CELL_SC_CROSS_CHECK, 4000);
+    ASSERT_EQ(scheduler.next(1500000), BMSDiagnostic_e::OPEN_WIRE);
+
+    ASSERT_EQ(scheduler.get_stats().runs[static_cast<size_t>(BMSDiagnostic_e::MUX_SELF_TEST)], 1);
+    ASSERT_EQ(scheduler.get_stats().last_duration_us[static_cast<size_t>(BMSDiagnostic_e::MUX_SELF_TEST)], 1000);
+    ASSERT_EQ(scheduler.get_stats().slots_deferred, 3);
+}
+
+TEST(DiagnosticsSlotSchedulerTesting, bus_time_stays_within_budget)
+{
+    // Slots every 10 ms for 10 s, diagnostics of 3-7 ms against a 2% budget
+    constexpr uint32_t budget_us_per_s = 20000;
+    DiagnosticsSlotScheduler scheduler(budget_us_per_s, {7000, 2000, 5000});
+    const std::array<uint32_t, NUM_BMS_DIAGNOSTICS> durations_us = {7000, 3000, 5000};
+    for (uint32_t now_us = 0; now_us < 10000000; now_us += 10000)
+    {
+        const BMSDiagnostic_e diagnostic = scheduler.next(now_us);
+        if (diagnostic != BMSDiagnostic_e::NUM_DIAGNOSTICS)
+        {
+            scheduler.record_run(diagnostic, durations_us[static_cast<size_t>(diagnostic)]);
+        }
+    }
+    ASSERT_LE(scheduler.get_stats().bus_time_used_us, 10 * budget_us_per_s);
+    ASSERT_GE(scheduler.get_stats().bus_time_used_us, 9 * budget_us_per_s);
+    // Taking turns: every diagnostic ran as often as the others, give or take one
+    for (size_t diagnostic = 0; diagnostic < NUM_BMS_DIAGNOSTICS; diagnostic++)
+    {
+        ASSERT_NEAR(scheduler.get_stats().runs[diagnostic], scheduler.get_stats().runs[0], 1);
+    }
+}
+
+TEST(DiagnosticsSlotSchedulerTesting, zero_budget_never_runs)
+{
+    DiagnosticsSlotScheduler scheduler(0, {0, 0, 0});
+    for (uint32_t now_us = 0; now_us < 5000000; now_us += 100000)
+    {
+        ASSERT_EQ(scheduler.next(now_us), BMSDiagnostic_e::NUM_DIAGNOSTICS);
+    }
+}
+
+TEST(DiagnosticsSlotSchedulerTesting, diagnostics_only_start_in_slots_long_enough)
+{
+    DiagnosticsSlotScheduler scheduler(1000000, {4000, 1000, 3000});
+    scheduler.next(0);
+    ASSERT_EQ(scheduler.next(100000, 3999), BMSDiagnostic_e::NUM_DIAGNOSTICS);
+    ASSERT_EQ(scheduler.get_stats().slots_too_short, 1);
+    // Holds its turn rather than letting the shorter ones go first
+    ASSERT_EQ(scheduler.next(100000, 2000), BMSDiagnostic_e::NUM_DIAGNOSTICS);
+    ASSERT_EQ(scheduler.next(100000, 4000), BMSDiagnostic_e::OPEN_WIRE);
+    ASSERT_EQ(scheduler.get_stats().slots_deferred, 1);
+}
+
+TEST(DiagnosticsSlotSchedulerTesting, slots_never_stretch_the_sample_period)
+{
+    // 100 Hz sampling, a read taking 2-5 ms of each 10 ms tick, diagnostics of 3-7 ms in whatever is left
+    constexpr uint32_t period_us = 10000;
+    DiagnosticsSlotScheduler scheduler(20000, {7000, 2000, 5000});
+    const std::array<uint32_t, NUM_BMS_DIAGNOSTICS> durations_us = {7000, 2000, 5000};
+    for (uint32_t tick = 0; tick < 1000; tick++)
+    {
+        const uint32_t tick_start_us = tick * period_us;
+        const uint32_t read_us = 2000 + ((tick * 7) % 4) * 1000;
+        const BMSDiagnostic_e diagnostic = scheduler.next(tick_start_us + read_us, period_us - read_us);
+        uint32_t tick_us = read_us;
+        if (diagnostic != BMSDiagnostic_e::NUM_DIAGNOSTICS)
+        {
+            scheduler.record_run(diagnostic, durations_us[static_cast<size_t>(diagnostic)]);
+            tick_us += durations_us[static_cast<size_t>(diagnostic)];
+        }
+        ASSERT_LE(tick_us, period_us);
+    }
+    // Open wire only fits after the shorter reads, but still gets its turns
+    for (size_t diagnostic = 0; diagnostic < NUM_BMS_DIAGNOSTICS; diagnostic++)
+    {
+        ASSERT_GT(scheduler.get_stats().runs[diagnostic], 0);
+    }
+}
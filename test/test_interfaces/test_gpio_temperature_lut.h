@@ -0,0 +1,70 @@
+#include "gtest/gtest.h"
+#include <cmath>
+#include <cstdint>
+
+#include "GPIOTemperatureLUT.h"
+
+/**
+ * The conversions BMSDriverGroup did per sample before the tables, in double precision with std::log
+ */
+double exact_thermistor_celsius(uint16_t gpio_in)
+{
+    double thermistor_resistance = (2740 / (gpio_in / 50000.0)) - 2740;
+    return 1 / ((1 / 298.15) + (1 / 3984.0) * std::log(thermistor_resistance / 10000.0)) - 272.15;
+}
+
+double exact_mcp9701_celsius(uint16_t gpio_in)
+{
+    return ((gpio_in / 10000.0) - 0.4) / 0.0195;
+}
+
+TEST(GPIOTemperatureLUTTesting, constexpr_log_matches_std_log)
+{
+    for (double x : {1e-4, 0.0274, 0.5, 1.0, 1.9999, 2.0, 3.14159, 274.0, 1e6})
+    {
+        ASSERT_NEAR(gpio_temperature_lut::constexpr_log(x), std::log(x), 1e-12) << "x = " << x;
+    }
+}
+
+TEST(GPIOTemperatureLUTTesting, thermistor_lut_error_is_bounded)
+{
+    double max_error = 0.0;
+    double max_error_operating = 0.0;
+    for (uint32_t code = 0; code <= UINT16_MAX; code++)
+    {
+        if (!gpio_temperature_lut::THERMISTOR_LUT.in_range(static_cast<uint16_t>(code)))
+        {
+            continue;
+        }
+        const double exact = exact_thermistor_celsius(static_cast<uint16_t>(code));
+        const double error = std::fabs(gpio_temperature_lut::thermistor_code_to_celsius(static_cast<uint16_t>(code)) - exact);
+        max_error = std::max(max_error, error);
+        if (exact > -20.0 && exact < 80.0)
+        {
+            max_error_operating = std::max(max_error_operating, error);
+        }
+    }
+    // Interpolation error grows with curvature, which is worst at the cold end of the table
+    ASSERT_LT(max_error, 0.1);
+    ASSERT_LT(max_error_operating, 0.01);
+}
+
+TEST(GPIOTemperatureLUTTesting, thermistor_outside_table_uses_exact_equation)
+{
+    for (uint16_t code : {1, 100, 255, 46400, 49000})
+    {
+        ASSERT_FALSE(gpio_temperature_lut::THERMISTOR_LUT.in_range(code));
+        ASSERT_NEAR(gpio_temperature_lut::thermistor_code_to_celsius(code), exact_thermistor_celsius(code), 1e-3) << "code = " << code;
+    }
+    // Shorted / open sensor readings stay what the driver always reported
+    ASSERT_FLOAT_EQ(gpio_temperature_lut::thermistor_code_to_celsius(0), static_cast<float>(exact_thermistor_celsius(0)));
+    ASSERT_TRUE(std::isnan(gpio_temperature_lut::thermistor_code_to_celsius(60000)));
+}
+
+TEST(GPIOTemperatureLUTTesting, mcp9701_lut_matches_linear_equation)
+{
+    for (uint32_t code = 0; code <= UINT16_MAX; code++)
+    {
+        ASSERT_NEAR(gpio_temperature_lut::mcp9701_code_to_celsius(static_cast<uint16_t>(code)), exact_mcp9701_celsius(static_cast<uint16_t>(code)), 1e-3) << "code = " << code;
+    }
+}
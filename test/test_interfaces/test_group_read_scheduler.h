@@ -0,0 +1,63 @@
+#include "gtest/gtest.h"
+#include <array>
+#include <random>
+#include <stddef.h>
+
+#include "GroupReadScheduler.h"
+
+TEST(GroupReadSchedulerTesting, no_hot_groups_is_round_robin)
+{
+    GroupReadScheduler scheduler(4, 12);
+    for (size_t read = 0; read < 60; read++)
+    {
+        ASSERT_EQ(scheduler.next(), static_cast<ReadGroup_e>(read % ReadGroup_e::NUM_GROUPS));
+    }
+    for (size_t group = 0; group < ReadGroup_e::NUM_GROUPS; group++)
+    {
+        ASSERT_EQ(scheduler.get_visit_stats().visits[group], 10);
+        ASSERT_EQ(scheduler.get_visit_stats().max_reads_between_visits[group], 5);
+        ASSERT_FLOAT_EQ(scheduler.get_visit_frequency(static_cast<ReadGroup_e>(group)), 1.0f / 6.0f);
+    }
+    ASSERT_EQ(scheduler.get_visit_stats().staleness_visits, 0);
+}
+
+TEST(GroupReadSchedulerTesting, hot_groups_are_read_by_weight)
+{
+    // Weights 4 + 4 + 1 * 4 = 12: the hot groups get a third of the reads each, the rest a twelfth
+    GroupReadScheduler scheduler(4, 12);
+    scheduler.set_hot_groups((1U << ReadGroup_e::CV_GROUP_B) | (1U << ReadGroup_e::AUX_GROUP_A));
+    for (size_t read = 0; read < 1200; read++)
+    {
+        scheduler.next();
+    }
+    ASSERT_NEAR(scheduler.get_visit_frequency(ReadGroup_e::CV_GROUP_B), 4.0f / 12.0f, 0.01f);
+    ASSERT_NEAR(scheduler.get_visit_frequency(ReadGroup_e::AUX_GROUP_A), 4.0f / 12.0f, 0.01f);
+    ASSERT_NEAR(scheduler.get_visit_frequency(ReadGroup_e::CV_GROUP_D), 1.0f / 12.0f, 0.01f);
+    for (size_t group = 0; group < ReadGroup_e::NUM_GROUPS; group++)
+    {
+        ASSERT_LE(scheduler.get_visit_stats().max_reads_between_visits[group], 12);
+    }
+}
+
+TEST(GroupReadSchedulerTesting, staleness_bound_holds_for_any_hot_groups)
+{
+    constexpr uint16_t max_staleness = 8;
+    GroupReadScheduler scheduler(16, max_staleness);
+    std::mt19937 rng(22);
+    std::uniform_int_distribution<int> hot_groups(0, (1 << ReadGroup_e::NUM_GROUPS) - 1);
+
+    std::array<size_t, ReadGroup_e::NUM_GROUPS> last_read = {};
+    for (size_t read = 1; read <= 5000; read++)
+    {
+        if (read % 7 == 0)
+        {
+            scheduler.set_hot_groups(static_cast<uint8_t>(hot_groups(rng)));
+        }
+        last_read[scheduler.next()] = read;
+        for (size_t group = 0; group < ReadGroup_e::NUM_GROUPS; group++)
+        {
+            ASSERT_LE(read - last_read[group], max_staleness);
+        }
+    }
+    ASSERT_GT(scheduler.get_visit_stats().staleness_visits, 0);
+}
@@ -0,0 +1,197 @@
+#include "gtest/gtest.h"
+#include <array>
+#include <stddef.h>
+
+#include "LTCCommandFrames.h"
+
+constexpr uint16_t LTC6811_CRC15_POLY = 0x4599;
+constexpr ltc_command_frames::PEC15Table pec15_table = ltc_command_frames::make_pec15_table(LTC6811_CRC15_POLY);
+constexpr ltc_command_frames::CommandFrameTable_s default_frames = ltc_command_frames::make_command_frame_table(pec15_table, 0, 0);
+
+// Known command PECs from the data sheet: WRCFGA -> 0x3D6E, RDCFGA -> 0x2B0A, RDCVA -> 0x07C2
+static_assert(default_frames.write_config[2] == 0x3D && default_frames.write_config[3] == 0x6E, "WRCFGA PEC");
+static_assert(default_frames.read_config[2] == 0x2B && default_frames.read_config[3] == 0x0A, "RDCFGA PEC");
+static_assert(default_frames.read_group[ReadGroup_e::CV_GROUP_A][2] == 0x07 && default_frames.read_group[ReadGroup_e::CV_GROUP_A][3] == 0xC2, "RDCVA PEC");
+
+/**
+ * The runtime generator exactly as BMSDriverGroup implemented it: byte-wise table CRC15 with a 0x10 seed.
+ * Kept independent of ltc_command_frames so the constexpr table is checked against it, not against itself.
+ */
+std::array<uint8_t, 4> runtime_cmd_pec(uint16_t cmd_code)
+{
+    std::array<uint16_t, 256> table{};
+    for (int i = 0; i < 256; i++)
+    {
+        uint16_t remainder = i << 7;
+        for (int bit = 8; bit > 0; --bit)
+        {
+            remainder = (remainder & 0x4000) ? ((remainder << 1) ^ LTC6811_CRC15_POLY) : (remainder << 1);
+        }
+        table[i] = remainder;
+    }
+
+    std::array<uint8_t, 2> cmd = {static_cast<uint8_t>(cmd_code >> 8), static_cast<uint8_t>(cmd_code)};
+    uint16_t remainder = 0x10;
+    for (uint8_t byte : cmd)
+    {
+        uint16_t addr = ((remainder >> 7) ^ byte) & 0xff;
+        remainder = (remainder << 8) ^ table[addr];
+    }
+    remainder = remainder * 2;
+    return {cmd[0], cmd[1], static_cast<uint8_t>(remainder >> 8), static_cast<uint8_t>(remainder)};
+}
+
+TEST(LTCCommandFramesTesting, pec_table_matches_runtime_table)
+{
+    auto runtime_table = ltc_command_frames::make_pec15_table(LTC6811_CRC15_POLY);
+    for (size_t i = 0; i < 256; i++)
+    {
+        ASSERT_EQ(pec15_table[i], runtime_table[i]);
+    }
+}
+
+TEST(LTCCommandFramesTesting, read_and_write_frames_match_runtime_generator)
+{
+    const std::array<std::pair<CMD_CODES_e, std::array<uint8_t, 4>>, 6> read_groups = {{
+        {CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_A, default_frames.read_group[ReadGroup_e::CV_GROUP_A]},
+        {CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_B, default_frames.read_group[ReadGroup_e::CV_GROUP_B]},
+        {CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_C, default_frames.read_group[ReadGroup_e::CV_GROUP_C]},
+        {CMD_CODES_e::READ_CELL_VOLTAGE_GROUP_D, default_frames.read_group[ReadGroup_e::CV_GROUP_D]},
+        {CMD_CODES_e::READ_GPIO_VOLTAGE_GROUP_A, default_frames.read_group[ReadGroup_e::AUX_GROUP_A]},
+        {CMD_CODES_e::READ_GPIO_VOLTAGE_GROUP_B, default_frames.read_group[ReadGroup_e::AUX_GROUP_B]},
+    }};
+    for (const auto &group : read_groups)
+    {
+        ASSERT_EQ(group.second, runtime_cmd_pec(static_cast<uint16_t>(group.first)));
+    }
+
+    ASSERT_EQ(default_frames.write_config, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::WRITE_CONFIG)));
+    ASSERT_EQ(default_frames.write_s_control, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::WRITE_S_CONTROL)));
+    ASSERT_EQ(default_frames.write_pwm, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::WRITE_PWM)));
+    ASSERT_EQ(default_frames.write_comm, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::WRITE_COMM)));
+    ASSERT_EQ(default_frames.read_config, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::READ_CONFIG)));
+    ASSERT_EQ(default_frames.read_status_a, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::READ_STATUS_GROUP_A)));
+    ASSERT_EQ(default_frames.read_status_b, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::READ_STATUS_GROUP_B)));
+    ASSERT_EQ(default_frames.read_s_control, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::READ_S_CONTROL)));
+    ASSERT_EQ(default_frames.read_pwm, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::READ_PWM)));
+    ASSERT_EQ(default_frames.read_comm, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::READ_COMM)));
+    ASSERT_EQ(default_frames.clear_status, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::CLEAR_STATUS)));
+    ASSERT_EQ(default_frames.poll_adc_status, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::POLL_ADC_STATUS)));
+    ASSERT_EQ(default_frames.diagnose_mux, runtime_cmd_pec(static_cast<uint16_t>(CMD_CODES_e::DIAGNOSE_MUX_POLL_STATUS)));
+}
+
+TEST(LTCCommandFramesTesting, adc_start_frames_match_runtime_generator)
+{
+    for (uint8_t dcp = 0; dcp < 2; dcp++)
+    {
+        for (uint8_t cell_select = 0; cell_select < 7; cell_select++)
+        {
+            auto frames = ltc_command_frames::make_command_frame_table(pec15_table, dcp, cell_select);
+            for (uint8_t md = 0; md < ltc_command_frames::NUM_ADC_MODES; md++)
+            {
+                // Same bit packing the driver used before the table existed
+                uint16_t adcv = (uint16_t)CMD_CODES_e::START_CV_ADC_CONVERSION | (md << 7) | (dcp << 4) | cell_select;
+                uint16_t adax = (uint16_t)CMD_CODES_e::START_GPIO_ADC_CONVERSION | (md << 7);
+                uint16_t adcvax = (uint16_t)CMD_CODES_e::START_CV_GPIO_ADC_CONVERSION | (md << 7) | (dcp << 4);
+                uint16_t adcvsc = (uint16_t)CMD_CODES_e::START_CV_SC_CONVERSION | (md << 7) | (dcp << 4);
+                uint16_t adstat_sc = (uint16_t)CMD_CODES_e::START_STATUS_ADC_CONVERSION | (md << 7) | 0x1;
+                uint16_t adow_pull_up = (uint16_t)CMD_CODES_e::START_OPEN_WIRE_CONVERSION | (md << 7) | 0x40 | (dcp << 4);
+                uint16_t adow_pull_down = (uint16_t)CMD_CODES_e::START_OPEN_WIRE_CONVERSION | (md << 7) | (dcp << 4);
+
+                ASSERT_EQ(frames.start_cv_adc[md], runtime_cmd_pec(adcv));
+                ASSERT_EQ(frames.start_gpio_adc[md], runtime_cmd_pec(adax));
+                ASSERT_EQ(frames.start_cv_gpio_adc[md], runtime_cmd_pec(adcvax));
+                ASSERT_EQ(frames.start_cv_sc_adc[md], runtime_cmd_pec(adcvsc));
+                ASSERT_EQ(frames.start_status_sc_adc[md], runtime_cmd_pec(adstat_sc));
+                ASSERT_EQ(frames.start_open_wire_pull_up[md], runtime_cmd_pec(adow_pull_up));
+                ASSERT_EQ(frames.start_open_wire_pull_down[md], runtime_cmd_pec(adow_pull_down));
+            }
+        }
+    }
+}
+
+TEST(LTCCommandFramesTesting, status_b_cell_flags_decode)
+{
+    // STBR2-4: C1UV is bit 0 of STBR2, C1OV bit 1, ..., C12OV bit 7 of STBR4
+    const uint8_t no_flags[6] = {0x12, 0x34, 0x00, 0x00, 0x00, 0xA0};
+    ASSERT_EQ(ltc_command_frames::decode_cell_voltage_flags(no_flags, true), 0);
+    ASSERT_EQ(ltc_command_frames::decode_cell_voltage_flags(no_flags, false), 0);
+
+    const uint8_t all_flags[6] = {0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00};
+    ASSERT_EQ(ltc_command_frames::decode_cell_voltage_flags(all_flags, true), 0x0FFF);
+    ASSERT_EQ(ltc_command_frames::decode_cell_voltage_flags(all_flags, false), 0x0FFF);
+
+    // C1UV, C4OV, C5OV, C7UV, C12OV
+    const uint8_t some_flags[6] = {0xFF, 0xFF, 0b10000001, 0b00010010, 0b10000000, 0xFF};
+    ASSERT_EQ(ltc_command_frames::decode_cell_voltage_flags(some_flags, true), (1U << 3) | (1U << 4) | (1U << 11));
+    ASSERT_EQ(ltc_command_frames::decode_cell_voltage_flags(some_flags, false), (1U << 0) | (1U << 6));
+}
+
+TEST(LTCCommandFramesTesting, status_a_sum_of_cells_decode)
+{
+    // 12 cells at 3.7 V = 44.4 V = 22200 * 2 mV, little endian in STAR0-1
+    const uint8_t status_a[6] = {0xB8, 0x56, 0x12, 0x34, 0x56, 0x78};
+    ASSERT_EQ(ltc_command_frames::decode_sum_of_cells_code(status_a), 22200);
+}
+
+TEST(LTCCommandFramesTesting, status_b_mux_fail_and_thermal_shutdown_decode)
+{
+    // STBR5: REV[3:0] RSVD RSVD MUXFAIL THSD
+    const uint8_t healthy[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0};
+    ASSERT_FALSE(ltc_command_frames::decode_mux_fail(healthy));
+    ASSERT_FALSE(ltc_command_frames::decode_thermal_shutdown(healthy));
+
+    const uint8_t mux_fail[6] = {0x00, 0x00, 0x00, 0x00, 0x00, 0xF2};
+    ASSERT_TRUE(ltc_command_frames::decode_mux_fail(mux_fail));
+    ASSERT_FALSE(ltc_command_frames::decode_thermal_shutdown(mux_fail));
+
+    const uint8_t thermal_shutdown[6] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
+    ASSERT_FALSE(ltc_command_frames::decode_mux_fail(thermal_shutdown));
+    ASSERT_TRUE(ltc_command_frames::decode_thermal_shutdown(thermal_shutdown));
+}
+
+TEST(LTCCommandFramesTesting, open_wires_decode)
+{
+    std::array<uint16_t, 12> pull_up{};
+    std::array<uint16_t, 12> pull_down{};
+    pull_up.fill(37000);
+    pull_down.fill(37000);
+    ASSERT_EQ(ltc_command_frames::decode_open_wires(pull_up, pull_down, 12), 0);
+
+    // C3 open: the pull-up current drags cell 4 down and cell 3 up, the pull-down current the other way round
+    pull_up[3] = 30000;
+    pull_up[2] = 44000;
+    pull_down[3] = 44000;
+    pull_down[2] = 30000;
+    ASSERT_EQ(ltc_command_frames::decode_open_wires(pull_up, pull_down, 12), 1U << 3);
+
+    // C0 open with pull-up, and the top wire of a 9 cell chip with pull-down
+    pull_up.fill(37000);
+    pull_down.fill(37000);
+    pull_up[0] = 0;
+    pull_down[8] = 0;
+    ASSERT_EQ(ltc_command_frames::decode_open_wires(pull_up, pull_down, 9), (1U << 0) | (1U << 9));
+
+    // Unused inputs above the chip's cells are ignored
+    pull_down[11] = 0;
+    pull_up[10] = 0;
+    ASSERT_EQ(ltc_command_frames::decode_open_wires(pull_up, pull_down, 9), (1U << 0) | (1U << 9));
+}
+
+TEST(LTCCommandFramesTesting, config_readback_compare)
+{
+    // GPIOs on, REFON, VUV 1874, VOV 2625, DCC1 + DCC12, DCTO 0
+    const std::array<uint8_t, 6> written = {0xFC, 0x52, 0x17, 0xA4, 0x01, 0x08};
+    const uint8_t same[6] = {0xFC, 0x52, 0x17, 0xA4, 0x01, 0x08};
+    ASSERT_TRUE(ltc_command_frames::config_readback_matches(same, written));
+
+    // GPIO pin levels, DTEN and the DCTO timer don't have to read back as written
+    const uint8_t pins_and_timer[6] = {0x06, 0x52, 0x17, 0xA4, 0x01, 0xF8};
+    ASSERT_TRUE(ltc_command_frames::config_readback_matches(pins_and_timer, written));
+
+    const uint8_t lost_dcc12[6] = {0xFC, 0x52, 0x17, 0xA4, 0x01, 0x00};
+    ASSERT_FALSE(ltc_command_frames::config_readback_matches(lost_dcc12, written));
+
+    const uint8_t reset_chip[6] = {0xF8, 0x00, 0x00, 0x00, 0x00, 0x00};
+    ASSERT_FALSE(ltc_command_frames::config_readback_matches(reset_chip, written));
+}
@@ -0,0 +1,152 @@
+#include "gtest/gtest.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <stddef.h>
+
+#include "LTCCommandFrames.h"
+
+constexpr size_t PEC_TEST_CHIPS_PER_CS = 6;
+using GroupResponse = std::array<uint8_t, 8 * PEC_TEST_CHIPS_PER_CS>;
+
+constexpr ltc_command_frames::PEC15Table pec_validation_table = ltc_command_frames::make_pec15_table(0x4599);
+constexpr ltc_command_frames::PEC15SliceTable pec_validation_slices = ltc_command_frames::make_pec15_slice_table(pec_validation_table);
+
+/**
+ * Random register data with a correct PEC on every chip
+ */
+GroupResponse make_valid_response(std::mt19937 &rng)
+{
+    GroupResponse response{};
+    for (size_t chip = 0; chip < PEC_TEST_CHIPS_PER_CS; chip++)
+    {
+        uint8_t *packet = response.data() + (8 * chip);
+        for (size_t i = 0; i < 6; i++)
+        {
+            packet[i] = static_cast<uint8_t>(rng());
+        }
+        auto pec = ltc_command_frames::calculate_pec(pec_validation_table, packet, 6);
+        packet[6] = pec[0];
+        packet[7] = pec[1];
+    }
+    return response;
+}
+
+/**
+ * The per-chip check BMSDriverGroup did before the batched validator, copies and all
+ */
+uint32_t bytewise_valid_mask(const GroupResponse &response)
+{
+    uint32_t valid_mask = 0;
+    for (size_t chip = 0; chip < PEC_TEST_CHIPS_PER_CS; chip++)
+    {
+        std::array<uint8_t, 6> sample_packet;
+        std::array<uint8_t, 2> sample_pec;
+        std::copy_n(response.begin() + (8 * chip), 6, sample_packet.begin());
+        std::copy_n(response.begin() + (8 * chip) + 6, 2, sample_pec.begin());
+        auto calculated_pec = ltc_command_frames::calculate_pec(pec_validation_table, sample_packet.data(), 6);
+        valid_mask |= static_cast<uint32_t>(calculated_pec[0] == sample_pec[0] && calculated_pec[1] == sample_pec[1]) << chip;
+    }
+    return valid_mask;
+}
+
+// Both paths agree at compile time too
+static_assert(ltc_command_frames::calculate_pec_wordwise(pec_validation_slices, std::array<uint8_t, 6>{}.data(), 3) ==
+                  ((ltc_command_frames::calculate_pec(pec_validation_table, std::array<uint8_t, 6>{}.data(), 6)[0] << 8) |
+                   ltc_command_frames::calculate_pec(pec_validation_table, std::array<uint8_t, 6>{}.data(), 6)[1]),
+              "word-wise PEC of zeros");
+
+TEST(LTCPECValidationTesting, wordwise_pec_matches_bytewise_pec)
+{
+    std::mt19937 rng(6811);
+    for (int trial = 0; trial < 10000; trial++)
+    {
+        std::array<uint8_t, 6> data;
+        for (auto &byte : data)
+        {
+            byte = static_cast<uint8_t>(rng());
+        }
+        auto bytewise = ltc_command_frames::calculate_pec(pec_validation_table, data.data(), 6);
+        ASSERT_EQ(ltc_command_frames::calculate_pec_wordwise(pec_validation_slices, data.data(), 3), (bytewise[0] << 8) | bytewise[1]);
+    }
+}
+
+TEST(LTCPECValidationTesting, valid_mask_flags_each_corrupted_chip)
+{
+    std::mt19937 rng(12);
+    const uint32_t all_valid = (1U << PEC_TEST_CHIPS_PER_CS) - 1;
+    for (int trial = 0; trial < 1000; trial++)
+    {
+        GroupResponse response = make_valid_response(rng);
+        ASSERT_EQ(ltc_command_frames::validate_group_response_pecs<PEC_TEST_CHIPS_PER_CS>(pec_validation_slices, response), all_valid);
+
+        // Flip one bit anywhere in the buffer, data or PEC, only that chip may drop out
+        const size_t bit = rng() % (8 * response.size());
+        response[bit / 8] ^= static_cast<uint8_t>(1U << (bit % 8));
+        const uint32_t expected = all_valid & ~(1U << (bit / 64));
+        ASSERT_EQ(ltc_command_frames::validate_group_response_pecs<PEC_TEST_CHIPS_PER_CS>(pec_validation_slices, response), expected);
+        ASSERT_EQ(bytewise_valid_mask(response), expected);
+    }
+}
+
+TEST(LTCPECValidationTesting, all_zero_and_all_ones_responses_are_invalid)
+{
+    // What a disconnected (0x00) or floating (0xFF) isoSPI line reads back
+    GroupResponse zeros{};
+    GroupResponse ones{};
+    ones.fill(0xFF);
+    ASSERT_EQ(ltc_command_frames::validate_group_response_pecs<PEC_TEST_CHIPS_PER_CS>(pec_validation_slices, zeros), 0U);
+    ASSERT_EQ(ltc_command_frames::validate_group_response_pecs<PEC_TEST_CHIPS_PER_CS>(pec_validation_slices, ones), 0U);
+}
+
+/**
+ * Native microbenchmark of the old per-chip path against the batched validator. Only the results are
+ * checked; the timings are printed for comparison since they depend on the host.
+ */
+TEST(LTCPECValidationTesting, benchmark_bytewise_vs_batched_validation)
+{
+    constexpr size_t num_responses = 256;
+    constexpr int num_passes = 500;
+    std::mt19937 rng(42);
+    std::array<GroupResponse, num_responses> responses;
+    for (auto &response : responses)
+    {
+        response = make_valid_response(rng);
+        if (rng() % 4 == 0)
+        {
+            response[rng() % response.size()] ^= 0x10;
+        }
+    }
+
+    volatile uint32_t sink = 0;
+    uint32_t bytewise_accumulated = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < num_passes; pass++)
+    {
+        for (const auto &response : responses)
+        {
+            bytewise_accumulated += bytewise_valid_mask(response);
+        }
+    }
+    auto bytewise_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    sink = bytewise_accumulated;
+
+    uint32_t batched_accumulated = 0;
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < num_passes; pass++)
+    {
+        for (const auto &response : responses)
+        {
+            batched_accumulated += ltc_command_frames::validate_group_response_pecs<PEC_TEST_CHIPS_PER_CS>(pec_validation_slices, response);
+        }
+    }
+    auto batched_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    sink = batched_accumulated;
+    (void)sink;
+
+    ASSERT_EQ(bytewise_accumulated, batched_accumulated);
+    const double num_checked = static_cast<double>(num_responses) * num_passes;
+    std::printf("[ PEC bench ] bytewise: %.1f ns/response, batched: %.1f ns/response\n",
+                bytewise_ns / num_checked, batched_ns / num_checked);
+}
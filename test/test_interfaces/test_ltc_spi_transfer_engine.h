@@ -0,0 +1,223 @@
+#include "gtest/gtest.h"
+#include <array>
+#include <vector>
+#include <string>
+#include <stddef.h>
+
+#include "LTCSPITransferEngine.h"
+
+/**
+ * Stands in for SPI1 + DMA: records every frame it is asked to start and only "finishes" one when
+ * the test calls complete(), the same way the DMA interrupt would fire some time later.
+ * Chip select and wake clocks are logged as events so step order and timing can be checked.
+ */
+class MockTransferBackend
+{
+public:
+    bool begin_transfer(int cs, const uint8_t *tx, uint8_t *rx, size_t length, void (*on_complete)(void *), void *context)
+    {
+        if (refuse_transfers)
+        {
+            return false;
+        }
+        started_cs.push_back(cs);
+        events.push_back("frame " + std::to_string(cs));
+        sent.emplace_back(tx, tx + length);
+        for (size_t i = 0; i < length; i++)
+        {
+            rx[i] = static_cast<uint8_t>(cs + i); // recognisable per chip select
+        }
+        _on_complete = on_complete;
+        _context = context;
+        return true;
+    }
+
+    void write_chip_select(int cs, bool level)
+    {
+        events.push_back((level ? "high " : "low ") + std::to_string(cs));
+    }
+
+    void send_wake_clocks(int cs)
+    {
+        events.push_back("clocks " + std::to_string(cs));
+    }
+
+    void complete()
+    {
+        auto callback = _on_complete;
+        _on_complete = nullptr;
+        callback(_context);
+    }
+
+    bool refuse_transfers = false;
+    std::vector<int> started_cs;
+    std::vector<std::vector<uint8_t>> sent;
+    std::vector<std::string> events;
+
+private:
+    void (*_on_complete)(void *) = nullptr;
+    void *_context = nullptr;
+};
+
+using TestTransferEngine = ltc_spi_interface::AsyncTransferEngine<MockTransferBackend, 8, 2>;
+using ltc_spi_interface::AsyncTransferState_e;
+
+constexpr std::array<uint8_t, 4> rdcva = {0x00, 0x04, 0x07, 0xC2};
+
+TEST(LTCSPITransferEngineTesting, start_returns_before_transfer_completes)
+{
+    TestTransferEngine engine;
+    ASSERT_TRUE(engine.queue_frame(36, rdcva.data(), rdcva.size()));
+    ASSERT_TRUE(engine.start(0));
+
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::IN_FLIGHT);
+    ASSERT_EQ(engine.get_backend().started_cs, std::vector<int>({36}));
+    // Command is sent first, then zeros to clock the register data back
+    ASSERT_EQ(engine.get_backend().sent[0], std::vector<uint8_t>({0x00, 0x04, 0x07, 0xC2, 0, 0, 0, 0}));
+    ASSERT_EQ(engine.get_num_completed_frames(), 0);
+}
+
+TEST(LTCSPITransferEngineTesting, chained_frames_start_from_service_after_the_chip_select_hold)
+{
+    TestTransferEngine engine;
+    engine.queue_frame(36, rdcva.data(), rdcva.size());
+    engine.queue_frame(38, rdcva.data(), rdcva.size());
+    engine.start(0);
+
+    // The completion callback never starts the next frame itself
+    engine.get_backend().complete();
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::IN_FLIGHT);
+    ASSERT_EQ(engine.get_backend().started_cs, std::vector<int>({36}));
+
+    engine.service(100);
+    engine.service(100 + ltc_spi_interface::FRAME_CS_HIGH_HOLD_US - 1);
+    ASSERT_EQ(engine.get_backend().started_cs, std::vector<int>({36}));
+    engine.service(100 + ltc_spi_interface::FRAME_CS_HIGH_HOLD_US);
+    ASSERT_EQ(engine.get_backend().started_cs, std::vector<int>({36, 38}));
+
+    // Nothing follows the last frame, so it completes on the first service() after it
+    engine.get_backend().complete();
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::IN_FLIGHT);
+    engine.service(200);
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::COMPLETE);
+    ASSERT_EQ(engine.get_num_completed_frames(), 2);
+    ASSERT_EQ(engine.get_received_frame(0)[5], 36 + 5);
+    ASSERT_EQ(engine.get_received_frame(1)[5], 38 + 5);
+}
+
+TEST(LTCSPITransferEngineTesting, cannot_queue_or_start_until_released)
+{
+    TestTransferEngine engine;
+    engine.queue_frame(36, rdcva.data(), rdcva.size());
+    engine.start(0);
+
+    ASSERT_FALSE(engine.start(0));
+    ASSERT_FALSE(engine.queue_frame(38, rdcva.data(), rdcva.size()));
+    engine.release(); // ignored while in flight
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::IN_FLIGHT);
+
+    engine.get_backend().complete();
+    engine.service(0);
+    ASSERT_FALSE(engine.queue_frame(38, rdcva.data(), rdcva.size()));
+
+    engine.release();
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::IDLE);
+    ASSERT_EQ(engine.get_num_frames(), 0);
+    ASSERT_TRUE(engine.queue_frame(38, rdcva.data(), rdcva.size()));
+}
+
+TEST(LTCSPITransferEngineTesting, queue_is_bounded)
+{
+    TestTransferEngine engine;
+    std::array<uint8_t, 9> too_long = {};
+    ASSERT_FALSE(engine.queue_frame(36, too_long.data(), too_long.size()));
+    ASSERT_TRUE(engine.queue_frame(36, rdcva.data(), rdcva.size()));
+    ASSERT_TRUE(engine.queue_frame(38, rdcva.data(), rdcva.size()));
+    ASSERT_FALSE(engine.queue_frame(36, rdcva.data(), rdcva.size()));
+    ASSERT_FALSE(TestTransferEngine().start(0)); // nothing queued
+}
+
+TEST(LTCSPITransferEngineTesting, backend_refusal)
+{
+    TestTransferEngine engine;
+    engine.queue_frame(36, rdcva.data(), rdcva.size());
+    engine.queue_frame(38, rdcva.data(), rdcva.size());
+
+    engine.get_backend().refuse_transfers = true;
+    ASSERT_FALSE(engine.start(0));
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::IDLE);
+
+    // Refused part way through: the first frame's data is still reported
+    engine.queue_frame(36, rdcva.data(), rdcva.size());
+    engine.queue_frame(38, rdcva.data(), rdcva.size());
+    engine.get_backend().refuse_transfers = false;
+    ASSERT_TRUE(engine.start(0));
+    engine.get_backend().refuse_transfers = true;
+    engine.get_backend().complete();
+    engine.service(0);
+    engine.service(ltc_spi_interface::FRAME_CS_HIGH_HOLD_US);
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::COMPLETE);
+    ASSERT_EQ(engine.get_num_frames(), 2);
+    ASSERT_EQ(engine.get_num_completed_frames(), 1);
+}
+
+TEST(LTCSPITransferEngineTesting, wakeup_pulses_are_timed_steps)
+{
+    ltc_spi_interface::AsyncTransferEngine<MockTransferBackend, 8, 2, 8> engine;
+    ASSERT_TRUE(engine.queue_wakeup_pulses(36, 2, 400));
+    ASSERT_TRUE(engine.queue_frame(36, rdcva.data(), rdcva.size()));
+    ASSERT_EQ(engine.get_num_steps(), 7);
+    ASSERT_FALSE(engine.queue_wakeup_pulses(36, 1, 400)); // 3 more steps would not fit
+
+    const uint32_t start_us = 0xFFFFFF00; // wraps mid sequence
+    ASSERT_TRUE(engine.start(start_us));
+    auto &events = engine.get_backend().events;
+    ASSERT_EQ(events, std::vector<std::string>({"low 36"}));
+
+    // Nothing runs early, and service() never waits
+    engine.service(start_us + 399);
+    ASSERT_EQ(events.size(), 1);
+    engine.service(start_us + 400);
+    ASSERT_EQ(events, std::vector<std::string>({"low 36", "clocks 36", "high 36"}));
+    engine.service(start_us + 799);
+    ASSERT_EQ(events.size(), 3);
+    engine.service(start_us + 800);
+    engine.service(start_us + 1200);
+    ASSERT_EQ(events.size(), 6);
+    ASSERT_TRUE(engine.get_backend().started_cs.empty());
+
+    // The frame waits for the second pulse's high time too
+    engine.service(start_us + 1600);
+    ASSERT_EQ(events.back(), "frame 36");
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::IN_FLIGHT);
+    engine.service(start_us + 5000);
+    ASSERT_EQ(events.size(), 7);
+
+    engine.get_backend().complete();
+    engine.service(start_us + 5000);
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::COMPLETE);
+    ASSERT_EQ(engine.get_num_completed_frames(), 1);
+}
+
+TEST(LTCSPITransferEngineTesting, timed_steps_after_frame_run_from_service)
+{
+    ltc_spi_interface::AsyncTransferEngine<MockTransferBackend, 8, 2, 8> engine;
+    engine.queue_frame(36, rdcva.data(), rdcva.size());
+    engine.queue_wakeup_pulses(38, 1, 10);
+    engine.queue_frame(38, rdcva.data(), rdcva.size());
+    engine.start(100);
+
+    engine.get_backend().complete(); // frame 36 done, the pulse on 38 waits out the chip select hold
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::IN_FLIGHT);
+    engine.service(1000);
+    ASSERT_EQ(engine.get_backend().events, std::vector<std::string>({"frame 36"}));
+    engine.service(1000 + ltc_spi_interface::FRAME_CS_HIGH_HOLD_US);
+    engine.service(1015);
+    engine.service(1025);
+    ASSERT_EQ(engine.get_backend().events, std::vector<std::string>({"frame 36", "low 38", "clocks 38", "high 38", "frame 38"}));
+
+    engine.get_backend().complete();
+    engine.service(1030);
+    ASSERT_EQ(engine.get_state(), AsyncTransferState_e::COMPLETE);
+    ASSERT_EQ(engine.get_num_completed_frames(), 2);
+}
@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+#include <array>
+#include <cstdint>
+#include <random>
+#include <stddef.h>
+
+#include "MinMaxTree.h"
+
+constexpr size_t MIN_MAX_TEST_NUM_VALUES = 126;
+
+/**
+ * Checks the tree against a full scan of the same values, ties going to the lowest index
+ */
+void expect_matches_scan(const MinMaxTree<uint16_t, MIN_MAX_TEST_NUM_VALUES> &tree,
+                         const std::array<uint16_t, MIN_MAX_TEST_NUM_VALUES> &values,
+                         const std::array<bool, MIN_MAX_TEST_NUM_VALUES> &present)
+{
+    size_t min_index = SIZE_MAX;
+    size_t max_index = SIZE_MAX;
+    for (size_t i = 0; i < MIN_MAX_TEST_NUM_VALUES; i++)
+    {
+        if (!present[i])
+        {
+            continue;
+        }
+        if (min_index == SIZE_MAX || values[i] < values[min_index])
+        {
+            min_index = i;
+        }
+        if (max_index == SIZE_MAX || values[i] > values[max_index])
+        {
+            max_index = i;
+        }
+    }
+
+    ASSERT_EQ(tree.empty(), min_index == SIZE_MAX);
+    if (min_index != SIZE_MAX)
+    {
+        ASSERT_EQ(tree.min_index(), min_index);
+        ASSERT_EQ(tree.max_index(), max_index);
+        ASSERT_EQ(tree.min_value(), values[min_index]);
+        ASSERT_EQ(tree.max_value(), values[max_index]);
+    }
+}
+
+TEST(MinMaxTreeTesting, starts_empty)
+{
+    MinMaxTree<uint16_t, MIN_MAX_TEST_NUM_VALUES> tree;
+    ASSERT_TRUE(tree.empty());
+    ASSERT_FALSE(tree.contains(0));
+
+    tree.update(42, 37000);
+    ASSERT_FALSE(tree.empty());
+    ASSERT_EQ(tree.min_index(), 42U);
+    ASSERT_EQ(tree.max_index(), 42U);
+
+    tree.remove(42);
+    ASSERT_TRUE(tree.empty());
+}
+
+TEST(MinMaxTreeTesting, extreme_that_rises_is_replaced)
+{
+    // The case running min / max tracking gets wrong: the minimum cell charges up and another cell becomes the minimum
+    MinMaxTree<uint16_t, MIN_MAX_TEST_NUM_VALUES> tree;
+    for (size_t cell = 0; cell < MIN_MAX_TEST_NUM_VALUES; cell++)
+    {
+        tree.update(cell, 37000);
+    }
+    tree.update(10, 35000);
+    tree.update(90, 36000);
+    ASSERT_EQ(tree.min_index(), 10U);
+
+    tree.update(10, 38000);
+    ASSERT_EQ(tree.min_index(), 90U);
+    ASSERT_EQ(tree.max_index(), 10U);
+}
+
+TEST(MinMaxTreeTesting, ties_go_to_lowest_index)
+{
+    MinMaxTree<uint16_t, MIN_MAX_TEST_NUM_VALUES> tree;
+    tree.update(100, 5);
+    tree.update(7, 5);
+    tree.update(64, 5);
+    ASSERT_EQ(tree.min_index(), 7U);
+    ASSERT_EQ(tree.max_index(), 7U);
+}
+
+TEST(MinMaxTreeTesting, random_updates_and_removals_match_full_scan)
+{
+    std::mt19937 rng(6811);
+    MinMaxTree<uint16_t, MIN_MAX_TEST_NUM_VALUES> tree;
+    std::array<uint16_t, MIN_MAX_TEST_NUM_VALUES> values = {};
+    std::array<bool, MIN_MAX_TEST_NUM_VALUES> present = {};
+
+    for (int step = 0; step < 20000; step++)
+    {
+        const size_t index = rng() % MIN_MAX_TEST_NUM_VALUES;
+        if (rng() % 8 == 0)
+        {
+            tree.remove(index);
+            present[index] = false;
+        }
+        else
+        {
+            // Narrow range so ties are common
+            values[index] = static_cast<uint16_t>(36000 + (rng() % 64));
+            present[index] = true;
+            tree.update(index, values[index]);
+        }
+        expect_matches_scan(tree, values, present);
+        if (HasFatalFailure())
+        {
+            FAIL() << "step " << step;
+        }
+    }
+}
@@ -299,4 +299,177 @@ TEST(ACUControllerTesting, cell_undervoltage_fault_persistence)
     status = controller.evaluate_accumulator(after_fault_time, data, 0, ZERO_PACK_CURRENT, num_cells);
     ASSERT_EQ(status.last_time_uv_fault_not_present, init_time); // Still stuck at init_time
     ASSERT_EQ(status.has_fault, true);                           // 1100ms > 1000ms - FAULT!
-}
\ No newline at end of file
+}
+
+TEST(ACUControllerTesting, hardware_ov_flag_starts_fault_timer)
+{
+    ACUControllerInstance::create(thresholds);
+    ACUController controller = ACUControllerInstance::instance();
+
+    charging_enabled = false;
+    const uint32_t init_time = 1000;
+    const uint32_t after_fault_time = 2100;
+
+    controller.init(init_time, 430.0);
+
+    // Read back voltages are all fine, but the LTC6811 comparator has seen a cell above VOV
+    BMSCoreData_s data = {
+        3.70f,  // min cell v - normal
+        4.10f,  // max cell v - normal, the flagged cell's group hasn't been read yet
+        450.0f, // pack v - normal
+        40.0f,  // cell temp c - normal
+        20.0f,  // min cell temp c
+        35.0f,  // board temp c - normal
+        true,   // cell OV flagged
+        false   // cell UV flagged
+    };
+
+    auto status = controller.evaluate_accumulator(init_time, data, 0, ZERO_PACK_CURRENT, num_cells);
+    ASSERT_EQ(status.last_time_ov_fault_not_present, init_time);
+    ASSERT_EQ(status.last_time_uv_fault_not_present, init_time);
+
+    status = controller.evaluate_accumulator(after_fault_time, data, 0, ZERO_PACK_CURRENT, num_cells);
+    ASSERT_EQ(status.last_time_ov_fault_not_present, init_time); // Not refreshed while the flag is set
+    ASSERT_EQ(status.last_time_uv_fault_not_present, after_fault_time);
+    ASSERT_EQ(status.has_fault, true);
+
+    // Flag cleared, the timer is refreshed again
+    data.cell_ov_flagged = false;
+    status = controller.evaluate_accumulator(after_fault_time + 10, data, 0, ZERO_PACK_CURRENT, num_cells);
+    ASSERT_EQ(status.last_time_ov_fault_not_present, after_fault_time + 10);
+}
+
+TEST(ACUControllerTesting, hardware_uv_flag_starts_fault_timer)
+{
+    ACUControllerInstance::create(thresholds);
+    ACUController controller = ACUControllerInstance::instance();
+
+    charging_enabled = false;
+    const uint32_t init_time = 1000;
+    const uint32_t after_fault_time = 2100;
+
+    controller.init(init_time, 430.0);
+
+    // Read back voltages are all fine, but the LTC6811 comparator has seen a cell below VUV
+    BMSCoreData_s data = {
+        3.70f,  // min cell v - normal, the flagged cell's group hasn't been read yet
+        4.10f,  // max cell v - normal
+        450.0f, // pack v - normal
+        40.0f,  // cell temp c - normal
+        20.0f,  // min cell temp c
+        35.0f,  // board temp c - normal
+        false,  // cell OV flagged
+        true    // cell UV flagged
+    };
+
+    auto status = controller.evaluate_accumulator(init_time, data, 0, ZERO_PACK_CURRENT, num_cells);
+    status = controller.evaluate_accumulator(after_fault_time, data, 0, ZERO_PACK_CURRENT, num_cells);
+    ASSERT_EQ(status.last_time_uv_fault_not_present, init_time); // Not refreshed while the flag is set
+    ASSERT_EQ(status.last_time_ov_fault_not_present, after_fault_time);
+    ASSERT_EQ(status.has_fault, true);
+
+    data.cell_uv_flagged = false;
+    status = controller.evaluate_accumulator(after_fault_time + 10, data, 0, ZERO_PACK_CURRENT, num_cells);
+    ASSERT_EQ(status.last_time_uv_fault_not_present, after_fault_time + 10);
+}
+
+// IR compensation only applies to measured voltages, a comparator flag is never compensated away
+TEST(ACUControllerTesting, hardware_uv_flag_holds_under_discharge_current)
+{
+    ACUControllerInstance::create(thresholds);
+    ACUController controller = ACUControllerInstance::instance();
+
+    charging_enabled = false;
+    const uint32_t init_time = 1000;
+    const uint32_t after_fault_time = 2100;
+
+    controller.init(init_time, 430.0);
+
+    BMSCoreData_s data = {
+        3.05f,  // min cell v - at the UV threshold, IR compensation alone would clear it at 100 A
+        4.10f,  // max cell v - normal
+        450.0f, // pack v - normal
+        40.0f,  // cell temp c - normal
+        20.0f,  // min cell temp c
+        35.0f,  // board temp c - normal
+        false,  // cell OV flagged
+        true    // cell UV flagged
+    };
+
+    auto status = controller.evaluate_accumulator(init_time, data, 0, -100.0f, num_cells); // -100A = discharge
+    status = controller.evaluate_accumulator(after_fault_time, data, 0, -100.0f, num_cells);
+    ASSERT_EQ(status.last_time_uv_fault_not_present, init_time);
+    ASSERT_EQ(status.has_fault, true);
+
+    // Same reading without the flag is IR compensated as before
+    data.cell_uv_flagged = false;
+    status = controller.evaluate_accumulator(after_fault_time + 10, data, 0, -100.0f, num_cells);
+    ASSERT_EQ(status.last_time_uv_fault_not_present, after_fault_time + 10);
+}
+
+TEST(ACUControllerTesting, hardware_ov_flag_holds_under_charge_current)
+{
+    ACUControllerInstance::create(thresholds);
+    ACUController controller = ACUControllerInstance::instance();
+
+    charging_enabled = false;
+    const uint32_t init_time = 1000;
+    const uint32_t after_fault_time = 2100;
+
+    controller.init(init_time, 430.0);
+
+    BMSCoreData_s data = {
+        4.10f,  // min cell v - normal
+        4.20f,  // max cell v - at the OV threshold, IR compensation alone would clear it at 10 A
+        500.0f, // pack v - higher during charge
+        40.0f,  // cell temp c - normal
+        20.0f,  // min cell temp c
+        35.0f,  // board temp c - normal
+        true,   // cell OV flagged
+        false   // cell UV flagged
+    };
+
+    auto status = controller.evaluate_accumulator(init_time, data, 0, 10.0f, num_cells); // +10A = charge
+    status = controller.evaluate_accumulator(after_fault_time, data, 0, 10.0f, num_cells);
+    ASSERT_EQ(status.last_time_ov_fault_not_present, init_time);
+    ASSERT_EQ(status.has_fault, true);
+
+    data.cell_ov_flagged = false;
+    status = controller.evaluate_accumulator(after_fault_time + 10, data, 0, 10.0f, num_cells);
+    ASSERT_EQ(status.last_time_ov_fault_not_present, after_fault_time + 10);
+}
+
+TEST(ACUControllerTesting, hardware_flags_hold_under_opposite_current)
+{
+    ACUControllerInstance::create(thresholds);
+    ACUController controller = ACUControllerInstance::instance();
+
+    charging_enabled = false;
+    const uint32_t init_time = 1000;
+    const uint32_t after_fault_time = 2100;
+
+    controller.init(init_time, 430.0);
+
+    // OV flag while discharging and UV flag while charging: the flags don't depend on the current direction either
+    BMSCoreData_s data = {
+        3.70f,  // min cell v - normal
+        4.10f,  // max cell v - normal
+        450.0f, // pack v - normal
+        40.0f,  // cell temp c - normal
+        20.0f,  // min cell temp c
+        35.0f,  // board temp c - normal
+        true,   // cell OV flagged
+        false   // cell UV flagged
+    };
+    auto status = controller.evaluate_accumulator(init_time, data, 0, -100.0f, num_cells);
+    status = controller.evaluate_accumulator(after_fault_time, data, 0, -100.0f, num_cells);
+    ASSERT_EQ(status.last_time_ov_fault_not_present, init_time);
+
+    data.cell_ov_flagged = false;
+    data.cell_uv_flagged = true;
+    controller.init(init_time, 430.0);
+    status = controller.evaluate_accumulator(init_time, data, 0, 10.0f, num_cells);
+    status = controller.evaluate_accumulator(after_fault_time, data, 0, 10.0f, num_cells);
+    ASSERT_EQ(status.last_time_uv_fault_not_present, init_time);
+    ASSERT_EQ(status.has_fault, true);
+}
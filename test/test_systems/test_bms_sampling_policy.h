@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+#include <stddef.h>
+
+#include "BMSSamplingPolicy.h"
+
+constexpr BMSSamplingPolicyConfig_s sampling_test_config = {
+    .slow_period_us = 250000,
+    .normal_period_us = 100000,
+    .fast_period_us = 10000,
+    .slow_adc_mode = ADC_MODE_e::FILTERED,
+    .cell_overvoltage_thresh_v = 4.2f,
+    .charging_fast_margin_v = 0.05f,
+    .charging_fast_hysteresis_v = 0.02f};
+
+TEST(BMSSamplingPolicyTesting, sampling_follows_state)
+{
+    BMSSamplingPolicy policy(sampling_test_config);
+    ASSERT_EQ(policy.get_sampling().rate, BMSSamplingRate_e::SLOW);
+    ASSERT_EQ(policy.get_sampling().adc_mode, ADC_MODE_e::FILTERED);
+
+    ASSERT_FALSE(policy.update(ACUState_e::STARTUP, 3.7f));
+
+    ASSERT_TRUE(policy.update(ACUState_e::ACTIVE, 3.7f));
+    ASSERT_EQ(policy.get_sampling().rate, BMSSamplingRate_e::FAST);
+    ASSERT_EQ(policy.get_sampling().period_us, 10000);
+    ASSERT_EQ(policy.get_sampling().adc_mode, ADC_MODE_e::FAST);
+
+    ASSERT_TRUE(policy.update(ACUState_e::CHARGING, 3.7f));
+    ASSERT_EQ(policy.get_sampling().rate, BMSSamplingRate_e::NORMAL);
+    ASSERT_EQ(policy.get_sampling().adc_mode, ADC_MODE_e::NORMAL);
+
+    ASSERT_TRUE(policy.update(ACUState_e::FAULTED, 3.7f));
+    ASSERT_EQ(policy.get_sampling().rate, BMSSamplingRate_e::SLOW);
+    ASSERT_EQ(policy.get_sampling().period_us, 250000);
+}
+
+TEST(BMSSamplingPolicyTesting, charging_near_ov_samples_fast_with_hysteresis)
+{
+    BMSSamplingPolicy policy(sampling_test_config);
+    policy.update(ACUState_e::CHARGING, 4.10f);
+    ASSERT_EQ(policy.get_sampling().rate, BMSSamplingRate_e::NORMAL);
+
+    ASSERT_TRUE(policy.update(ACUState_e::CHARGING, 4.15f)); // within 50 mV of OV
+    ASSERT_EQ(policy.get_sampling().rate, BMSSamplingRate_e::FAST);
+
+    ASSERT_FALSE(policy.update(ACUState_e::CHARGING, 4.14f)); // just below the margin, held by the hysteresis
+    ASSERT_EQ(policy.get_sampling().rate, BMSSamplingRate_e::FAST);
+
+    ASSERT_TRUE(policy.update(ACUState_e::CHARGING, 4.12f));
+    ASSERT_EQ(policy.get_sampling().rate, BMSSamplingRate_e::NORMAL);
+}
+
+TEST(BMSSamplingPolicyTesting, samples_are_decimated_to_the_period)
+{
+    BMSSamplingPolicy policy(sampling_test_config);
+    policy.update(ACUState_e::CHARGING, 3.7f); // 100 ms period
+
+    // Task ticks every 10 ms, slightly late every time
+    size_t samples = 0;
+    for (uint32_t tick = 0; tick < 100; tick++)
+    {
+        samples += policy.sample_due(1000 + (tick * 10000) + (tick % 3) * 200);
+    }
+    ASSERT_EQ(samples, 10);
+    ASSERT_NEAR(policy.get_effective_rate_hz(), 10.0f, 0.1f);
+
+    // A faster sampling restarts the effective rate
+    policy.update(ACUState_e::ACTIVE, 3.7f);
+    ASSERT_EQ(policy.get_effective_rate_hz(), 0.0f);
+    samples = 0;
+    for (uint32_t tick = 100; tick < 150; tick++)
+    {
+        samples += policy.sample_due(1000 + (tick * 10000));
+    }
+    ASSERT_EQ(samples, 50);
+    ASSERT_NEAR(policy.get_effective_rate_hz(), 100.0f, 0.1f);
+}
+
+TEST(BMSSamplingPolicyTesting, slow_sampling_uses_configured_adc_mode)
+{
+    BMSSamplingPolicyConfig_s config = sampling_test_config;
+    config.slow_adc_mode = ADC_MODE_e::NORMAL;
+    BMSSamplingPolicy policy(config);
+    ASSERT_EQ(policy.get_sampling().rate, BMSSamplingRate_e::SLOW);
+    ASSERT_EQ(policy.get_sampling().adc_mode, ADC_MODE_e::NORMAL);
+
+    policy.update(ACUState_e::ACTIVE, 3.7f);
+    ASSERT_TRUE(policy.update(ACUState_e::FAULTED, 3.7f));
+    ASSERT_EQ(policy.get_sampling().adc_mode, ADC_MODE_e::NORMAL);
+}
@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+#include <array>
+#include <stddef.h>
+
+#include "BMSSPIClockController.h"
+
+constexpr size_t CLOCK_TEST_CHIP_SELECTS = 2;
+constexpr uint32_t TOP_CLOCK_HZ = bms_spi_clock_defaults::CLOCK_STEPS_HZ.back();
+constexpr uint32_t BOTTOM_CLOCK_HZ = bms_spi_clock_defaults::CLOCK_STEPS_HZ.front();
+
+// Short hold offs so the tests do not need hundreds of updates
+constexpr BMSSPIClockControllerConfig_s clock_test_config = {
+    .step_down_failure_rate = 0.05f,
+    .step_up_failure_rate = 0.005f,
+    .updates_before_step_down = 2,
+    .updates_before_step_up = 5};
+
+TEST(BMSSPIClockControllerTesting, starts_at_top_clock)
+{
+    BMSSPIClockController<CLOCK_TEST_CHIP_SELECTS> controller(clock_test_config);
+    for (size_t cs = 0; cs < CLOCK_TEST_CHIP_SELECTS; cs++)
+    {
+        ASSERT_EQ(controller.get_clock_hz(cs), TOP_CLOCK_HZ);
+    }
+    // Quiet at the top stays at the top
+    for (int i = 0; i < 20; i++)
+    {
+        ASSERT_FALSE(controller.update({0.0f, 0.0f}));
+    }
+    ASSERT_EQ(controller.get_clock_hz(0), TOP_CLOCK_HZ);
+}
+
+TEST(BMSSPIClockControllerTesting, noisy_chip_select_steps_down_alone_with_hold_off)
+{
+    BMSSPIClockController<CLOCK_TEST_CHIP_SELECTS> controller(clock_test_config);
+
+    ASSERT_FALSE(controller.update({0.2f, 0.0f})); // first update, still within the hold off
+    ASSERT_TRUE(controller.update({0.2f, 0.0f}));
+    ASSERT_EQ(controller.get_clock_hz(0), bms_spi_clock_defaults::CLOCK_STEPS_HZ[2]);
+    ASSERT_EQ(controller.get_clock_hz(1), TOP_CLOCK_HZ);
+
+    ASSERT_FALSE(controller.update({0.2f, 0.0f}));
+    ASSERT_TRUE(controller.update({0.2f, 0.0f}));
+    ASSERT_EQ(controller.get_clock_hz(0), bms_spi_clock_defaults::CLOCK_STEPS_HZ[1]);
+
+    // Never below the bottom of the ladder
+    for (int i = 0; i < 20; i++)
+    {
+        controller.update({1.0f, 0.0f});
+    }
+    ASSERT_EQ(controller.get_clock_hz(0), BOTTOM_CLOCK_HZ);
+    ASSERT_EQ(controller.get_step_down_count(0), bms_spi_clock_defaults::CLOCK_STEPS_HZ.size() - 1);
+    ASSERT_EQ(controller.get_step_down_count(1), 0U);
+}
+
+TEST(BMSSPIClockControllerTesting, quiet_chip_select_recovers_slowly)
+{
+    BMSSPIClockController<CLOCK_TEST_CHIP_SELECTS> controller(clock_test_config);
+    controller.update({0.2f, 0.0f});
+    controller.update({0.2f, 0.0f});
+    ASSERT_EQ(controller.get_clock_hz(0), bms_spi_clock_defaults::CLOCK_STEPS_HZ[2]);
+
+    // Between the two thresholds nothing moves
+    for (int i = 0; i < 20; i++)
+    {
+        ASSERT_FALSE(controller.update({0.01f, 0.0f}));
+    }
+    ASSERT_EQ(controller.get_clock_hz(0), bms_spi_clock_defaults::CLOCK_STEPS_HZ[2]);
+
+    // The hold off has long run out, so the first quiet update steps back up, and the next one waits again
+    ASSERT_TRUE(controller.update({0.0f, 0.0f}));
+    ASSERT_EQ(controller.get_clock_hz(0), TOP_CLOCK_HZ);
+    ASSERT_EQ(controller.get_step_up_count(0), 1U);
+}